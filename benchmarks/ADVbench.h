@@ -0,0 +1,112 @@
+/**
+ * ADVbench - Minimal benchmark harness
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVBENCH_H
+#define ADVLIB_ADVBENCH_H
+
+// The benchmarks run on the host: they use the Standard Library
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace bench
+{
+
+// Hide a value from the optimizer so it is not removed, inlined or devirtualized
+template<typename T>
+void escape(T* p) { asm volatile("" : : "g"(p) : "memory"); }
+
+struct Options
+{
+    std::size_t warmup = 5;     // Runs not measured
+    std::size_t runs = 101;     // Runs measured
+    std::size_t ops = 10000;    // Operations per run
+    bool json = false;          // JSON lines instead of CSV
+};
+
+// --------------------------------------------------------------------
+// Run each benchmark warmup + runs times and print one line per benchmark
+// with the median and 99th percentile duration of one operation, in ns,
+// and the median number of operations per second.
+// --------------------------------------------------------------------
+
+struct Runner
+{
+    Runner(const Options& options, std::ostream& out): options_(options), out_(out)
+    {
+        if(!options_.json) out_ << "subject,target,operation,ops,runs,median_ns,p99_ns,min_ns,ops_per_s\n";
+    }
+
+    // body(ops) executes ops operations
+    template<typename Body>
+    void run(const char* subject, const char* target, const char* operation, Body body)
+    {
+        measure(subject, target, operation, options_.warmup, options_.runs, body);
+    }
+
+    // Same with at most max_runs runs and warmup runs, for slow baselines
+    template<typename Body>
+    void run(const char* subject, const char* target, const char* operation, std::size_t max_runs, Body body)
+    {
+        measure(subject, target, operation, std::min(options_.warmup, max_runs), std::min(options_.runs, max_runs), body);
+    }
+
+private:
+    static std::size_t p99_index(std::size_t size) { return (size * 99 + 99) / 100 - 1; }
+
+    template<typename Body>
+    void measure(const char* subject, const char* target, const char* operation, std::size_t warmup, std::size_t runs, Body& body)
+    {
+        for(std::size_t i = 0; i < warmup; ++i) body(options_.ops);
+
+        std::vector<double> durations;
+        durations.reserve(runs);
+        for(std::size_t i = 0; i < runs; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            body(options_.ops);
+            std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+            durations.push_back(elapsed.count() / options_.ops);
+        }
+
+        std::sort(durations.begin(), durations.end());
+        report(subject, target, operation, runs, durations[durations.size() / 2], durations[p99_index(durations.size())], durations.front());
+    }
+
+    void report(const char* subject, const char* target, const char* operation, std::size_t runs, double median, double p99, double min)
+    {
+        if(options_.json)
+            out_ << "{\"subject\":\"" << subject << "\",\"target\":\"" << target << "\",\"operation\":\"" << operation
+                 << "\",\"ops\":" << options_.ops << ",\"runs\":" << runs
+                 << ",\"median_ns\":" << median << ",\"p99_ns\":" << p99 << ",\"min_ns\":" << min << ",\"ops_per_s\":" << 1e9 / median << "}\n";
+        else
+            out_ << subject << ',' << target << ',' << operation << ',' << options_.ops << ',' << runs
+                 << ',' << median << ',' << p99 << ',' << min << ',' << 1e9 / median << '\n';
+    }
+
+    Options options_;
+    std::ostream& out_;
+};
+
+}
+
+#endif //ADVLIB_ADVBENCH_H
@@ -0,0 +1,52 @@
+#include "ADVbatch.h"
+#include "ADVbench.h"
+
+// Items processed through one callback call per item, and through batch
+// callbacks with batches from 1 to 4096 items. Times are per item.
+
+namespace
+{
+    using bench::escape;
+
+    const std::size_t MAX_ITEMS = 4096;
+    int samples[MAX_ITEMS];
+    long total = 0;
+
+    // Process ops items, by batches of n
+    template<typename C>
+    void by_batches(std::size_t ops, std::size_t n, C& callback)
+    {
+        for(std::size_t done = 0; done < ops; done += n)
+        {
+            std::size_t count = ops - done < n ? ops - done : n;
+            callback(adv::Span<const int>{samples + done % MAX_ITEMS, count});
+        }
+    }
+}
+
+void batch(bench::Runner& runner)
+{
+    static const char* const sizes[] = {"1", "4", "16", "64", "256", "1024", "4096"};
+
+    for(std::size_t i = 0; i < MAX_ITEMS; ++i) samples[i] = static_cast<int>(i & 0xFF);
+    auto process = [](int sample) { total += sample * 3 + 1; };
+
+    adv::Callback<void(*)(int)> scalar{process};
+    runner.run("per_item", "1", "process", [&](std::size_t ops)
+    {
+        escape(&scalar);
+        for(std::size_t i = 0; i < ops; ++i) scalar(samples[i % MAX_ITEMS]);
+        escape(&total);
+    });
+
+    adv::BatchCallback<const int> batched{adv::for_each(process)};
+    for(std::size_t s = 0, n = 1; n <= MAX_ITEMS; ++s, n *= 4)
+    {
+        runner.run("batch", sizes[s], "process", [&](std::size_t ops)
+        {
+            escape(&batched);
+            by_batches(ops, n, batched);
+            escape(&total);
+        });
+    }
+}
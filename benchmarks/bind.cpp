@@ -0,0 +1,45 @@
+#include "ADVbind.h"
+#include "ADVcallback.h"
+#include "ADVbench.h"
+
+// A callback of a method with two bound arguments, built with a lambda
+// wrapping a callback of the method and with bound arguments stored inline.
+
+namespace
+{
+    using bench::escape;
+
+    struct Heater
+    {
+        int set(int index, int offset, int value) { return temperatures_[index] = value + offset; }
+        int temperatures_[2] = {};
+    };
+
+    template<typename C>
+    void invoke(std::size_t ops, C& cb)
+    {
+        escape(&cb);
+        int r = 0;
+        for(std::size_t i = 0; i < ops; ++i) r += cb(static_cast<int>(i));
+        escape(&r);
+    }
+}
+
+void bound_arguments(bench::Runner& runner)
+{
+    using MyCallback = adv::Callback<int(*)(int), 64>;
+
+    static Heater heater;
+    int index = 1, offset = 2;
+    // What we did before: a lambda wrapping a callback of the member function
+    adv::Callback<int(*)(int, int, int)> set{heater, &Heater::set};
+    auto wrapped = [set, index, offset](int v) mutable { return set(index, offset, v); };
+    auto bound = adv::bind_front(&Heater::set, &heater, index, offset);
+    static_assert(sizeof(bound) < sizeof(wrapped), "Bound arguments are smaller than the lambda");
+
+    MyCallback cb_wrapped{wrapped};
+    MyCallback cb_bound{heater, &Heater::set, index, offset};
+
+    runner.run("callback", "wrapped_lambda", "invoke", [&](std::size_t ops) { invoke(ops, cb_wrapped); });
+    runner.run("callback", "bound_arguments", "invoke", [&](std::size_t ops) { invoke(ops, cb_bound); });
+}
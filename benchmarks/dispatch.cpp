@@ -0,0 +1,253 @@
+#include <functional>
+#include <new>
+#include "ADVcallback.h"
+#include "ADVcompact_callback.h"
+#include "ADVdelegate.h"
+#include "ADVfunction_ref.h"
+#include "ADVcrtp.h"
+#include "ADVbench.h"
+
+// Construction, copy, assignment and invocation of the same targets
+// through adv::Callback, adv::CompactCallback, adv::Delegate, adv::FunctionRef, std::function,
+// function pointers, virtual calls and adv::Crtp static dispatch. Also the invocation of the
+// Callback implementation calling its target through a virtual Callable.
+
+namespace
+{
+    using bench::escape;
+    using Runner = bench::Runner;
+
+    int total = 0;
+    int add(int i) { return total += i; }
+
+    struct Num
+    {
+        int add(int i) { return n_ += i; }
+        int get(int i) const { return n_ + i; }
+        int n_ = 0;
+    };
+
+    // Closures can not be assigned: destroy and copy them instead, as Callback does
+    template<typename L>
+    struct Closure
+    {
+        explicit Closure(const L& l): l_{l} {}
+        Closure(const Closure& other): l_{other.l_} {}
+        Closure& operator=(const Closure& other) { l_.~L(); new(&l_) L{other.l_}; return *this; }
+        int operator()(int i) { return l_(i); }
+        L l_;
+    };
+
+    // Virtual dispatch
+    struct Target
+    {
+        virtual ~Target() = default;
+        virtual int call(int i) = 0;
+    };
+
+    struct VirtualFunction: Target
+    {
+        int call(int i) override { return add(i); }
+    };
+
+    struct VirtualMethod: Target
+    {
+        explicit VirtualMethod(Num& num): num_{&num} {}
+        int call(int i) override { return num_->add(i); }
+        Num* num_;
+    };
+
+    template<typename L>
+    struct VirtualLambda: Target
+    {
+        explicit VirtualLambda(const L& l): lambda_{l} {}
+        int call(int i) override { return lambda_(i); }
+        Closure<L> lambda_;
+    };
+
+    // Static dispatch
+    template<typename Self>
+    struct Static: adv::Crtp<Self, Static>
+    {
+        int call(int i) { return this->self().do_call(i); }
+    };
+
+    struct StaticFunction: Static<StaticFunction>
+    {
+        int do_call(int i) { return add(i); }
+    };
+
+    struct StaticMethod: Static<StaticMethod>
+    {
+        explicit StaticMethod(Num& num): num_{&num} {}
+        int do_call(int i) { return num_->add(i); }
+        Num* num_;
+    };
+
+    template<typename L>
+    struct StaticLambda: Static<StaticLambda<L>>
+    {
+        explicit StaticLambda(const L& l): lambda_{l} {}
+        int do_call(int i) { return lambda_(i); }
+        Closure<L> lambda_;
+    };
+
+    // The implementation of Callback before invokers: a Callable placed inside the buffer and called through its vtable
+    template<typename>
+    struct VirtualCallback;
+
+    template <typename R, typename... A>
+    struct VirtualCallback<R(*)(A...)>
+    {
+        explicit VirtualCallback(R(*f)(A...)) { new(buffer_) adv::CallableFunction<R, A...>(f); }
+        template <typename O>
+        VirtualCallback(O& o, R(O::*m)(A...)) { new(buffer_) adv::CallableMethod<O, R, A...>(o, m); }
+        template <typename O>
+        VirtualCallback(const O& o, R(O::*m)(A...) const) { new(buffer_) adv::CallableConstMethod<O, R, A...>(o, m); }
+        template<typename L>
+        explicit VirtualCallback(const L& l) { new(buffer_) adv::CallableFunctor<L, R, A...>(l); }
+
+        R operator()(A... args) { return !isNull_ ? (*callable())(args...) : R(); }
+
+    private:
+        adv::Callable<R, A...>* callable() { return reinterpret_cast<adv::Callable<R, A...>*>(buffer_); }
+
+        alignas(void*) char buffer_[32] = {};
+        bool isNull_ = false;
+    };
+
+    // Sizes of the targets stored in Callback and in VirtualCallback: a Callable adds its vtable pointer
+    static_assert(sizeof(adv::CallableFunction<int, int>) == sizeof(adv::internal::Function<int, int>) + sizeof(void*),
+                  "A CallableFunction is a Function and a vtable pointer");
+    static_assert(sizeof(adv::CallableMethod<Num, int, int>) == sizeof(adv::internal::Method<Num, int, int>) + sizeof(void*),
+                  "A CallableMethod is a Method and a vtable pointer");
+    static_assert(sizeof(adv::CallableConstMethod<Num, int, int>) == sizeof(adv::internal::ConstMethod<Num, int, int>) + sizeof(void*),
+                  "A CallableConstMethod is a ConstMethod and a vtable pointer");
+
+    // Callback keeps its invoker and manager beside the buffer, VirtualCallback a flag (the vtable pointer is in the buffer)
+    static_assert(sizeof(adv::Callback<int(*)(int)>) == 32 + 2 * sizeof(void*), "A Callback is a buffer and two pointers");
+    static_assert(sizeof(VirtualCallback<int(*)(int)>) == 32 + sizeof(void*), "A VirtualCallback is a buffer and a flag");
+
+    static_assert(sizeof(adv::Delegate<int(*)(int)>) == 2 * sizeof(void*), "A Delegate is two pointers");
+    static_assert(sizeof(adv::FunctionRef<int(*)(int)>) == 2 * sizeof(void*), "A FunctionRef is two pointers");
+
+    template<typename Make, typename Call>
+    void measure_invoke(Runner& runner, const char* subject, const char* target, Make make, Call call)
+    {
+        runner.run(subject, target, "invoke", [&](std::size_t ops)
+        {
+            auto t = make();
+            auto* p = &t;
+            escape(&p);
+            int r = 0;
+            for(std::size_t i = 0; i < ops; ++i) r += call(*p, static_cast<int>(i));
+            escape(&r);
+        });
+    }
+
+    // make() returns a new object, call(object, i) invokes it
+    template<typename Make, typename Call>
+    void measure(Runner& runner, const char* subject, const char* target, Make make, Call call)
+    {
+        using T = decltype(make());
+
+        runner.run(subject, target, "construct", [&](std::size_t ops)
+        {
+            for(std::size_t i = 0; i < ops; ++i) { T t = make(); escape(&t); }
+        });
+
+        runner.run(subject, target, "copy", [&](std::size_t ops)
+        {
+            T source = make();
+            for(std::size_t i = 0; i < ops; ++i) { escape(&source); T t(source); escape(&t); }
+        });
+
+        runner.run(subject, target, "assign", [&](std::size_t ops)
+        {
+            T a = make();
+            T b = make();
+            for(std::size_t i = 0; i < ops; ++i) { escape(&b); a = b; escape(&a); }
+        });
+
+        runner.run(subject, target, "invoke", [&](std::size_t ops)
+        {
+            T t = make();
+            T* p = &t;
+            escape(&p);
+            int r = 0;
+            for(std::size_t i = 0; i < ops; ++i) r += call(*p, static_cast<int>(i));
+            escape(&r);
+        });
+    }
+}
+
+void dispatch(Runner& runner)
+{
+    using Callback = adv::Callback<int(*)(int)>;
+    using Compact = adv::CompactCallback<int(*)(int)>;
+    using Function = std::function<int(int)>;
+    using Pointer = int(*)(int);
+    using Handler = adv::Delegate<int(*)(int)>;
+    using Ref = adv::FunctionRef<int(*)(int)>;
+    using Legacy = VirtualCallback<int(*)(int)>;
+
+    static Num num;
+    const int captured = 1;
+    auto lambda = [](int i) { return total += i; };
+    auto functor = [captured](int i) { return total += i + captured; };
+    static_assert(sizeof(adv::CallableFunctor<decltype(functor), int, int>) >= sizeof(functor) + sizeof(void*),
+                  "A CallableFunctor is a functor and a vtable pointer");
+
+    auto call_callback = [](Callback& cb, int i) { return cb(i); };
+    auto call_compact = [](Compact& cb, int i) { return cb(i); };
+    auto call_function = [](Function& f, int i) { return f(i); };
+    auto call_pointer = [](Pointer& f, int i) { return f(i); };
+    auto call_delegate = [](Handler& d, int i) { return d(i); };
+    auto call_ref = [](Ref& f, int i) { return f(i); };
+    auto call_virtual = [](Target& t, int i) { return t.call(i); };
+    auto call_static = [](auto& t, int i) { return t.call(i); };
+    auto call_legacy = [](Legacy& cb, int i) { return cb(i); };
+
+    measure(runner, "pointer", "function", []{ return Pointer{&add}; }, call_pointer);
+    measure(runner, "pointer", "lambda", [&]{ return Pointer{lambda}; }, call_pointer);
+
+    measure(runner, "callback", "function", []{ return Callback{&add}; }, call_callback);
+    measure(runner, "callback", "method", []{ return Callback{num, &Num::add}; }, call_callback);
+    measure(runner, "callback", "const_method", []{ return Callback{num, &Num::get}; }, call_callback);
+    measure(runner, "callback", "lambda", [&]{ return Callback{lambda}; }, call_callback);
+    measure(runner, "callback", "functor", [&]{ return Callback{functor}; }, call_callback);
+
+    measure(runner, "compact", "function", []{ return Compact{&add}; }, call_compact);
+    measure(runner, "compact", "method", []{ return Compact::bind<Num, &Num::add>(num); }, call_compact);
+    measure(runner, "compact", "lambda", [&]{ return Compact{lambda}; }, call_compact);
+    measure(runner, "compact", "functor", [&]{ return Compact{functor}; }, call_compact);
+
+    measure(runner, "delegate", "function", []{ return Handler{&add}; }, call_delegate);
+    measure(runner, "delegate", "method", []{ return Handler::bind<Num, &Num::add>(num); }, call_delegate);
+    measure(runner, "delegate", "lambda", [&]{ return Handler{lambda}; }, call_delegate);
+
+    measure(runner, "function_ref", "function", []{ return Ref{&add}; }, call_ref);
+    measure(runner, "function_ref", "method", []{ return Ref::bind<Num, &Num::add>(num); }, call_ref);
+    measure(runner, "function_ref", "lambda", [&]{ return Ref{lambda}; }, call_ref);
+    measure(runner, "function_ref", "functor", [&]{ return Ref{functor}; }, call_ref);
+
+    measure(runner, "std_function", "function", []{ return Function{&add}; }, call_function);
+    measure(runner, "std_function", "method", []{ return Function{[](int i) { return num.add(i); }}; }, call_function);
+    measure(runner, "std_function", "lambda", [&]{ return Function{lambda}; }, call_function);
+    measure(runner, "std_function", "functor", [&]{ return Function{functor}; }, call_function);
+
+    measure(runner, "virtual", "function", []{ return VirtualFunction{}; }, call_virtual);
+    measure(runner, "virtual", "method", []{ return VirtualMethod{num}; }, call_virtual);
+    measure(runner, "virtual", "lambda", [&]{ return VirtualLambda<decltype(lambda)>{lambda}; }, call_virtual);
+    measure(runner, "virtual", "functor", [&]{ return VirtualLambda<decltype(functor)>{functor}; }, call_virtual);
+
+    measure(runner, "crtp", "function", []{ return StaticFunction{}; }, call_static);
+    measure(runner, "crtp", "method", []{ return StaticMethod{num}; }, call_static);
+    measure(runner, "crtp", "lambda", [&]{ return StaticLambda<decltype(lambda)>{lambda}; }, call_static);
+    measure(runner, "crtp", "functor", [&]{ return StaticLambda<decltype(functor)>{functor}; }, call_static);
+
+    measure_invoke(runner, "virtual_callable", "function", []{ return Legacy{&add}; }, call_legacy);
+    measure_invoke(runner, "virtual_callable", "method", []{ return Legacy{num, &Num::add}; }, call_legacy);
+    measure_invoke(runner, "virtual_callable", "const_method", []{ return Legacy{num, &Num::get}; }, call_legacy);
+    measure_invoke(runner, "virtual_callable", "functor", [&]{ return Legacy{functor}; }, call_legacy);
+}
@@ -0,0 +1,65 @@
+#include "ADVfunction_ref.h"
+#include "ADVcallback.h"
+#include "ADVbench.h"
+
+// Iteration helpers taking the callable as a parameter, a FunctionRef or a
+// Callback: the parameter is built for each call of the helper, then called
+// for each value. Times are per value.
+
+namespace
+{
+    using bench::escape;
+
+    const std::size_t VALUES = 1000;
+    int values[VALUES];
+
+    int accumulate_ref(adv::FunctionRef<int(*)(int)> f, std::size_t n)
+    {
+        int r = 0;
+        for(std::size_t i = 0; i < n; ++i) r += f(values[i]);
+        return r;
+    }
+
+    int accumulate_callback(adv::Callback<int(*)(int)> f, std::size_t n)
+    {
+        int r = 0;
+        for(std::size_t i = 0; i < n; ++i) r += f(values[i]);
+        return r;
+    }
+
+    struct Num
+    {
+        int add(int i) { return n_ + i; }
+        int n_ = 1;
+    };
+
+    // Call accumulate(n) for ops values, by groups of VALUES
+    template<typename Accumulate>
+    void iterate(std::size_t ops, Accumulate accumulate)
+    {
+        escape(values);
+        int r = 0;
+        for(std::size_t done = 0; done < ops; done += VALUES)
+            r += accumulate(ops - done < VALUES ? ops - done : VALUES);
+        escape(&r);
+    }
+}
+
+void function_ref(bench::Runner& runner)
+{
+    using Ref = adv::FunctionRef<int(*)(int)>;
+    using Callback = adv::Callback<int(*)(int)>;
+
+    static Num num;
+    int factor = 2;
+    escape(&factor);
+
+    runner.run("function_ref", "functor", "iterate", [&](std::size_t ops)
+        { iterate(ops, [&](std::size_t n) { return accumulate_ref([factor](int v){ return v * factor; }, n); }); });
+    runner.run("callback", "functor", "iterate", [&](std::size_t ops)
+        { iterate(ops, [&](std::size_t n) { return accumulate_callback(Callback{[factor](int v){ return v * factor; }}, n); }); });
+    runner.run("function_ref", "method", "iterate", [&](std::size_t ops)
+        { iterate(ops, [&](std::size_t n) { return accumulate_ref(Ref::bind<Num, &Num::add>(num), n); }); });
+    runner.run("callback", "method", "iterate", [&](std::size_t ops)
+        { iterate(ops, [&](std::size_t n) { return accumulate_callback(Callback{num, &Num::add}, n); }); });
+}
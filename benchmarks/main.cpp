@@ -0,0 +1,44 @@
+#include <cstring>
+#include <iostream>
+#include "ADVbench.h"
+
+// Usage: ADVbench [--json] [--quick]
+//   --json   one JSON object per line instead of CSV
+//   --quick  a few short runs, to check that the benchmarks work
+
+void dispatch(bench::Runner& runner);
+void null_callback(bench::Runner& runner);
+void bound_arguments(bench::Runner& runner);
+void function_ref(bench::Runner& runner);
+void signal_emit(bench::Runner& runner);
+void spsc_queue(bench::Runner& runner);
+void timer_wheel(bench::Runner& runner);
+void resumable(bench::Runner& runner);
+void batch(bench::Runner& runner);
+void observer(bench::Runner& runner);
+void priority_queue(bench::Runner& runner);
+
+int main(int argc, char* argv[])
+{
+    bench::Options options;
+    for(int i = 1; i < argc; ++i)
+    {
+        if(std::strcmp(argv[i], "--json") == 0) options.json = true;
+        else if(std::strcmp(argv[i], "--quick") == 0) { options.warmup = 1; options.runs = 3; options.ops = 100; }
+        else { std::cerr << "Usage: " << argv[0] << " [--json] [--quick]\n"; return 1; }
+    }
+
+    bench::Runner runner{options, std::cout};
+    dispatch(runner);
+    null_callback(runner);
+    bound_arguments(runner);
+    function_ref(runner);
+    signal_emit(runner);
+    spsc_queue(runner);
+    timer_wheel(runner);
+    resumable(runner);
+    batch(runner);
+    observer(runner);
+    priority_queue(runner);
+    return 0;
+}
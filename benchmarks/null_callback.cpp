@@ -0,0 +1,53 @@
+#include "ADVcallback.h"
+#include "ADVbench.h"
+
+// A scheduler loop calling 64 callbacks of which only 1 in 16 has a target,
+// like the background tasks of tests/callback/callback3.cpp. Empty callbacks
+// call a no-op invoker; the baseline checks a flag before each call as
+// callbacks did before. Times are per callback.
+
+namespace
+{
+    using bench::escape;
+    using BackgroundTask = adv::Callback<void(*)()>;
+
+    // What callbacks were doing before: a flag checked before each call
+    struct FlaggedTask
+    {
+        FlaggedTask() = default;
+        explicit FlaggedTask(const BackgroundTask& task): task_{task}, isNull_{false} {}
+        void operator()() { if(!isNull_) task_(); }
+
+        BackgroundTask task_;
+        bool isNull_ = true;
+    };
+
+    static_assert(sizeof(BackgroundTask) < sizeof(FlaggedTask), "The flag makes callbacks larger");
+
+    const std::size_t TASKS = 64;
+    int counter = 0;
+    void tick() { ++counter; }
+
+    template<typename T>
+    void schedule(std::size_t ops, T (&tasks)[TASKS])
+    {
+        escape(tasks);
+        for(std::size_t done = 0; done < ops; done += TASKS)
+            for(auto& task: tasks) task();
+        escape(&counter);
+    }
+}
+
+void null_callback(bench::Runner& runner)
+{
+    static BackgroundTask tasks[TASKS];
+    static FlaggedTask flagged[TASKS];
+    for(std::size_t i = 0; i < TASKS; i += 16)
+    {
+        tasks[i] = BackgroundTask{tick};
+        flagged[i] = FlaggedTask{BackgroundTask{tick}};
+    }
+
+    runner.run("null_invoker", "1_in_16", "schedule", [](std::size_t ops) { schedule(ops, tasks); });
+    runner.run("null_flag", "1_in_16", "schedule", [](std::size_t ops) { schedule(ops, flagged); });
+}
@@ -0,0 +1,76 @@
+#include "ADVobserver.h"
+#include "ADVsignal.h"
+#include "ADVbench.h"
+
+// Connect/disconnect churn and emit of intrusive observers compared to
+// a Signal (slots in an array), with 64 listeners. Times are per listener.
+// The emit of a Signal is measured in signal.cpp.
+
+namespace
+{
+    using bench::escape;
+    using Sig = void(*)(int);
+
+    const std::size_t LISTENERS = 64;
+    int total = 0;
+
+    struct Listener
+    {
+        void on(int i) { total += i; }
+        adv::Observer<Sig> observer_{this, &Listener::on};
+    };
+
+    Listener listeners[LISTENERS];
+}
+
+void observer(bench::Runner& runner)
+{
+    using Slot = adv::Callback<Sig>;
+    using MySignal = adv::Signal<Sig, LISTENERS>;
+
+    // ops operations, by groups of LISTENERS
+    auto rounds = [](std::size_t ops) { return (ops + LISTENERS - 1) / LISTENERS; };
+
+    runner.run("observer", "64", "connect_disconnect", [&](std::size_t ops)
+    {
+        adv::Subject<Sig> subject;
+        for(std::size_t r = 0; r < rounds(ops); ++r)
+        {
+            for(auto& listener: listeners) subject.connect(listener.observer_);
+            escape(&subject);
+            for(auto& listener: listeners) listener.observer_.disconnect();
+        }
+    });
+
+    runner.run("signal_connection", "64", "connect_disconnect", [&](std::size_t ops)
+    {
+        MySignal signal;
+        MySignal::Connection connections[LISTENERS];
+        for(std::size_t r = 0; r < rounds(ops); ++r)
+        {
+            for(std::size_t i = 0; i < LISTENERS; ++i) connections[i] = signal.connect(Slot{listeners[i], &Listener::on});
+            escape(&signal);
+            for(auto& connection: connections) signal.disconnect(connection);
+        }
+    });
+
+    runner.run("signal_value", "64", "connect_disconnect", [&](std::size_t ops)
+    {
+        MySignal signal;
+        for(std::size_t r = 0; r < rounds(ops); ++r)
+        {
+            for(auto& listener: listeners) signal.connect(Slot{listener, &Listener::on});
+            escape(&signal);
+            for(auto& listener: listeners) signal.disconnect(listener, &Listener::on);
+        }
+    });
+
+    runner.run("observer", "64", "emit", [&](std::size_t ops)
+    {
+        adv::Subject<Sig> subject;
+        for(auto& listener: listeners) subject.connect(listener.observer_);
+        escape(&subject);
+        for(std::size_t r = 0; r < rounds(ops); ++r) subject.emit(static_cast<int>(r));
+        escape(&total);
+    });
+}
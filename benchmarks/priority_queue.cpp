@@ -0,0 +1,62 @@
+#include "ADVpriority_task_queue.h"
+#include "ADVtask_queue.h"
+#include "ADVbench.h"
+
+// Post then run 64 tasks with 2 to 8 priorities, with a PriorityTaskQueue
+// and with a bucketed queue (one FIFO per priority). Times are per task.
+
+namespace
+{
+    using bench::escape;
+    using Task = adv::Callback<void(*)()>;
+
+    const std::size_t TASKS = 64;
+    int total = 0;
+    void work() { ++total; }
+
+    // Baseline: one FIFO per priority, the highest non-empty one runs first
+    template<std::size_t Priorities, std::size_t N>
+    struct BucketQueue
+    {
+        bool post(unsigned char priority, const Task& task) { return buckets_[priority].post(task); }
+
+        bool run_next()
+        {
+            for(std::size_t p = Priorities; p > 0; --p)
+                if(buckets_[p - 1].run_pending(1) > 0) return true;
+            return false;
+        }
+
+        adv::TaskQueue<N> buckets_[Priorities];
+    };
+
+    template<typename Queue>
+    void post_and_run(std::size_t ops, std::size_t priorities)
+    {
+        Queue queue;
+        for(std::size_t done = 0; done < ops; done += TASKS)
+        {
+            for(std::size_t i = 0; i < TASKS; ++i)
+                queue.post(static_cast<unsigned char>((i * 7) % priorities), Task{work});
+            escape(&queue);
+            while(queue.run_next()) {}
+        }
+        escape(&total);
+    }
+
+    template<std::size_t Priorities>
+    void compare(bench::Runner& runner, const char* name)
+    {
+        runner.run("priority_heap", name, "post_run", [](std::size_t ops)
+            { post_and_run<adv::PriorityTaskQueue<TASKS>>(ops, Priorities); });
+        runner.run("priority_buckets", name, "post_run", [](std::size_t ops)
+            { post_and_run<BucketQueue<Priorities, TASKS>>(ops, Priorities); });
+    }
+}
+
+void priority_queue(bench::Runner& runner)
+{
+    compare<2>(runner, "2");
+    compare<4>(runner, "4");
+    compare<8>(runner, "8");
+}
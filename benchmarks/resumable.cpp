@@ -0,0 +1,70 @@
+#include "ADVresumable.h"
+#include "ADVtask_queue.h"
+#include "ADVbench.h"
+
+// Resuming a stackless task directly and from a TaskQueue, compared to the
+// same task written as a chain of Callbacks posted to a TaskQueue.
+// Times are per resume.
+
+namespace
+{
+    using Task = adv::Callback<void(*)()>;
+
+    struct Loop: adv::Resumable<Loop>
+    {
+        explicit Loop(std::size_t resumes): resumes_{resumes} {}
+
+        bool resume()
+        {
+            ADV_BEGIN();
+            for(i_ = 0; i_ < resumes_; ++i_) ADV_YIELD();
+            ADV_END();
+        }
+
+        std::size_t i_ = 0;
+        std::size_t resumes_;
+    };
+
+    // Baseline: the same task written as a chain of Callbacks
+    struct Chain
+    {
+        explicit Chain(std::size_t steps): steps_{steps} {}
+
+        template<typename Queue>
+        void step(Queue& queue)
+        {
+            if(++i_ < steps_) queue.post(Task{[this, &queue]{ step(queue); }});
+        }
+
+        std::size_t i_ = 0;
+        std::size_t steps_;
+    };
+}
+
+void resumable(bench::Runner& runner)
+{
+    runner.run("resumable", "direct", "resume", [](std::size_t ops)
+    {
+        Loop loop{ops};
+        while(loop.resume()) {}
+        bench::escape(&loop);
+    });
+
+    runner.run("resumable", "task_queue", "resume", [](std::size_t ops)
+    {
+        adv::TaskQueue<4> queue;
+        Loop loop{ops};
+        adv::start_in(queue, loop);
+        while(queue.run_pending() > 0) {}
+        bench::escape(&loop);
+    });
+
+    runner.run("callback_chain", "task_queue", "resume", [](std::size_t ops)
+    {
+        adv::TaskQueue<4> queue;
+        Chain chain{ops};
+        queue.post(Task{[&chain, &queue]{ chain.step(queue); }});
+        while(queue.run_pending() > 0) {}
+        bench::escape(&chain);
+    });
+}
@@ -0,0 +1,31 @@
+#include "ADVsignal.h"
+#include "ADVbench.h"
+
+// Emit of a Signal with 1 to 64 listeners. Times are per listener, as for
+// the observers, which also measure connect/disconnect churn.
+
+namespace
+{
+    using bench::escape;
+
+    int total = 0;
+    void listener(int i) { total += i; }
+}
+
+void signal_emit(bench::Runner& runner)
+{
+    using MySignal = adv::Signal<void(*)(int), 64>;
+    static const char* const counts[] = {"1", "2", "4", "8", "16", "32", "64"};
+
+    for(std::size_t c = 0, listeners = 1; listeners <= 64; ++c, listeners *= 2)
+    {
+        runner.run("signal", counts[c], "emit", [listeners](std::size_t ops)
+        {
+            MySignal signal;
+            for(std::size_t i = 0; i < listeners; ++i) signal.connect(adv::Callback<void(*)(int)>{listener});
+            escape(&signal);
+            for(std::size_t i = 0; i < ops; i += listeners) signal.emit(static_cast<int>(i));
+            escape(&total);
+        });
+    }
+}
@@ -0,0 +1,72 @@
+#include <atomic>
+#include <thread>
+#include "ADVspsc_queue.h"
+#include "ADVbench.h"
+
+// Callbacks transferred from a producer thread to a consumer thread through
+// an SpscQueue, pushed one by one or by batches. The producer thread is
+// started once and waits for each run: only the transfer is measured.
+// Times are per item, ops_per_s is the number of items per second.
+
+namespace
+{
+    using Task = adv::Callback<void(*)()>;
+    using Queue = adv::SpscQueue<1024>;
+
+    volatile std::size_t executed = 0;
+    void tick() { executed = executed + 1; }
+
+    template<std::size_t BatchSize>
+    struct Transfer
+    {
+        Transfer(): producer_{[this]{ produce(); }} {}
+        ~Transfer() { requested_.store(STOP, std::memory_order_release); producer_.join(); }
+
+        // Start the producer and consume the items
+        void operator()(std::size_t items)
+        {
+            executed = 0;
+            requested_.store(items, std::memory_order_release);
+            while(executed < items)
+                if(queue_.run_pending() == 0) std::this_thread::yield();
+        }
+
+    private:
+        static const std::size_t STOP = ~std::size_t{0};
+
+        void produce()
+        {
+            for(;;)
+            {
+                std::size_t items;
+                while((items = requested_.exchange(0, std::memory_order_acquire)) == 0) std::this_thread::yield();
+                if(items == STOP) return;
+                for(std::size_t i = 0; i < items;)
+                {
+                    Queue::Batch batch{queue_};
+                    std::size_t n = 0;
+                    for(; n < BatchSize && i < items && batch.push(Task{tick}); ++n) ++i;
+                    if(n == 0) std::this_thread::yield(); // Full
+                }
+            }
+        }
+
+        Queue queue_;
+        std::atomic<std::size_t> requested_{0}; // Items to push, STOP to end the producer
+        std::thread producer_;
+    };
+
+    template<std::size_t BatchSize>
+    void measure(bench::Runner& runner, const char* target)
+    {
+        Transfer<BatchSize> transfer; // The producer thread ends with the benchmark
+        runner.run("spsc_queue", target, "transfer", [&](std::size_t ops) { transfer(ops); });
+    }
+}
+
+void spsc_queue(bench::Runner& runner)
+{
+    measure<1>(runner, "batch_1");
+    measure<8>(runner, "batch_8");
+    measure<64>(runner, "batch_64");
+}
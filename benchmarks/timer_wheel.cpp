@@ -0,0 +1,70 @@
+#include "ADVtimer_wheel.h"
+#include "ADVbench.h"
+
+// Timers scheduled with delays from 1 to 1000 ticks then fired, by groups of
+// 10000, with a TimerWheel and with an array kept sorted by deadline.
+// Times are per timer. The sorted array is slow: it is measured fewer times.
+
+namespace
+{
+    using Task = adv::Callback<void(*)()>;
+
+    const std::size_t TIMERS = 10000;
+    const std::size_t SORTED_RUNS = 11;
+    int fired = 0;
+    void fire() { ++fired; }
+
+    // Baseline: timers kept sorted by deadline in an array
+    struct SortedTimers
+    {
+        struct Entry { unsigned long deadline; Task task; };
+
+        void schedule(unsigned long delay, const Task& task)
+        {
+            unsigned long deadline = now_ + delay;
+            std::size_t i = size_;
+            for(; i > 0 && entries_[i - 1].deadline > deadline; --i) entries_[i] = entries_[i - 1];
+            entries_[i] = Entry{deadline, task};
+            ++size_;
+        }
+
+        void advance(unsigned long now)
+        {
+            now_ = now;
+            std::size_t n = 0;
+            while(n < size_ && entries_[n].deadline <= now) entries_[n++].task();
+            for(std::size_t i = n; i < size_; ++i) entries_[i - n] = entries_[i];
+            size_ -= n;
+        }
+
+        unsigned long now() const { return now_; }
+
+        Entry entries_[TIMERS];
+        std::size_t size_ = 0;
+        unsigned long now_ = 0;
+    };
+
+    // Pseudo-random delays between 1 and 1000 ticks
+    unsigned long delay(std::size_t i) { return 1 + (i * 7919) % 1000; }
+
+    template<typename Timers>
+    void schedule_and_fire(std::size_t ops, Timers& timers)
+    {
+        for(std::size_t done = 0; done < ops; done += TIMERS)
+        {
+            std::size_t n = ops - done < TIMERS ? ops - done : TIMERS;
+            for(std::size_t i = 0; i < n; ++i) timers.schedule(delay(i), Task{fire});
+            for(unsigned long t = 1; t <= 1000; ++t) timers.advance(timers.now() + 1);
+        }
+        bench::escape(&fired);
+    }
+}
+
+void timer_wheel(bench::Runner& runner)
+{
+    static adv::TimerWheel<TIMERS, 1024> wheel;
+    static SortedTimers sorted;
+
+    runner.run("timer_wheel", "10000", "schedule_fire", [](std::size_t ops) { schedule_and_fire(ops, wheel); });
+    runner.run("sorted_array", "10000", "schedule_fire", SORTED_RUNS, [](std::size_t ops) { schedule_and_fire(ops, sorted); });
+}
@@ -0,0 +1,50 @@
+#include "ADVcallback.h"
+
+// Build and copy TARGETS callbacks, each with a distinct target. Half of
+// them are stored inline and half of them out of line. The targets are
+// trivially copyable unless NON_TRIVIAL is defined.
+
+using namespace adv;
+
+namespace
+{
+    using Cb = Callback<int(*)(int), 16, CALLBACK_ALIGN, HeapOverflow>;
+
+    struct Pointer
+    {
+        Pointer(int* p): p_{p} {}
+#ifdef NON_TRIVIAL
+        Pointer(const Pointer& other): p_{other.p_} {}
+        ~Pointer() {}
+#endif
+        int* p_;
+    };
+
+    template<int I>
+    struct Small
+    {
+        int operator()(int i) const { return *p_.p_ + i + I; }
+        Pointer p_;
+    };
+
+    template<int I>
+    struct Large
+    {
+        int operator()(int i) const { return *p_.p_ + *q_[2] + i + I; }
+        Pointer p_;
+        int* q_[3];
+    };
+
+    void escape(void* p) { asm volatile("" : : "g"(p) : "memory"); }
+
+    template<size_t... I>
+    void build(index_sequence<I...>, int* p)
+    {
+        Cb small[] = {Cb{Small<I>{p}}...};
+        Cb large[] = {Cb{Large<I>{p, {p, p, p}}}...};
+        Cb copies[] = {small[I]..., large[I]...};
+        escape(small); escape(large); escape(copies);
+    }
+}
+
+void build_callbacks(int* p) { build(make_index_sequence<TARGETS / 2>{}, p); }
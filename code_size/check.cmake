@@ -0,0 +1,36 @@
+# Check the text added by each distinct target of callbacks: a trivially copyable target costs
+# at most MAX_PER_TARGET bytes, and less than the others (they share their manager).
+# Usage: cmake -DSIZE=<size program> -DTARGETS=<n1;n2> -DMAX_PER_TARGET=<bytes>
+#              -DTRIVIAL=<obj1;obj2> -DNON_TRIVIAL=<obj1;obj2> -P check.cmake
+
+function(text_size object result)
+    execute_process(COMMAND ${SIZE} ${object} OUTPUT_VARIABLE output RESULT_VARIABLE failed)
+    if(failed)
+        message(FATAL_ERROR "Unable to get the size of ${object}")
+    endif()
+    string(REGEX MATCH "\n[ \t]*([0-9]+)" line "${output}")
+    set(${result} ${CMAKE_MATCH_1} PARENT_SCOPE)
+endfunction()
+
+# Bytes added by each target between the two builds
+function(growth objects result)
+    list(GET objects 0 small)
+    list(GET objects 1 large)
+    text_size(${small} small_size)
+    text_size(${large} large_size)
+    list(GET TARGETS 0 n1)
+    list(GET TARGETS 1 n2)
+    math(EXPR per_target "(${large_size} - ${small_size}) / (${n2} - ${n1})")
+    message(STATUS "${n1} targets: ${small_size} bytes, ${n2} targets: ${large_size} bytes, ${per_target} bytes per target")
+    set(${result} ${per_target} PARENT_SCOPE)
+endfunction()
+
+growth("${TRIVIAL}" trivial)
+growth("${NON_TRIVIAL}" non_trivial)
+if(trivial GREATER MAX_PER_TARGET)
+    message(FATAL_ERROR "Trivially copyable targets cost ${trivial} bytes each, more than ${MAX_PER_TARGET} bytes")
+endif()
+math(EXPR limit "${non_trivial} * 3 / 4")
+if(NOT trivial LESS limit)
+    message(FATAL_ERROR "Trivially copyable targets cost ${trivial} bytes each, others ${non_trivial} bytes")
+endif()
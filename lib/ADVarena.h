@@ -0,0 +1,109 @@
+/**
+ * ADVarena - Bump allocator reset in one operation
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVARENA_H
+#define ADVLIB_ADVARENA_H
+
+#include "ADVstd.h"
+
+namespace adv
+{
+
+// --------------------------------------------------------------------
+// Bytes of memory, allocated statically, for objects living until the
+// end of a frame or of a tick. Allocating is incrementing an offset;
+// nothing is freed before reset, which runs the registered destructors
+// (the last registered first) and makes all the memory available again.
+// Tag is used to declare several arenas of the same size.
+// This is not interrupt-safe.
+// --------------------------------------------------------------------
+
+template<size_t Bytes, typename Tag = void>
+struct FrameArena
+{
+    static const size_t capacity = Bytes;
+
+    // Return nullptr if the arena is exhausted. Memory is aligned as max_align_t.
+    static void* allocate(size_t size)
+    {
+        size = (size + ALIGN - 1) & ~(ALIGN - 1);
+        if(size > Bytes - used_) return nullptr;
+        void* p = storage_.data_ + used_;
+        used_ += size;
+        return p;
+    }
+
+    // Call the destructor of object at reset. Return false if the arena is exhausted.
+    template<typename T>
+    static bool destroy_at_reset(T* object)
+    {
+        auto finalizer = static_cast<Finalizer*>(allocate(sizeof(Finalizer)));
+        if(finalizer == nullptr) return false;
+        finalizer->destroy_ = &destroy<T>;
+        finalizer->object_ = object;
+        finalizer->next_ = finalizers_;
+        finalizers_ = finalizer;
+        return true;
+    }
+
+    // Destroy the registered objects and make all the memory available
+    static void reset()
+    {
+        for(Finalizer* finalizer = finalizers_; finalizer != nullptr; finalizer = finalizer->next_)
+            finalizer->destroy_(finalizer->object_);
+        finalizers_ = nullptr;
+        used_ = 0;
+    }
+
+    // Number of bytes currently allocated
+    static size_t used() { return used_; }
+
+private:
+    static const size_t ALIGN = alignof(max_align_t);
+
+    struct Finalizer
+    {
+        void (*destroy_)(void*);
+        void* object_;
+        Finalizer* next_;
+    };
+
+    template<typename T>
+    static void destroy(void* object) { static_cast<T*>(object)->~T(); }
+
+    struct Storage { alignas(max_align_t) unsigned char data_[Bytes]; };
+
+    static Storage storage_;
+    static size_t used_;
+    static Finalizer* finalizers_;
+};
+
+template<size_t Bytes, typename Tag>
+typename FrameArena<Bytes, Tag>::Storage FrameArena<Bytes, Tag>::storage_;
+
+template<size_t Bytes, typename Tag>
+size_t FrameArena<Bytes, Tag>::used_ = 0;
+
+template<size_t Bytes, typename Tag>
+typename FrameArena<Bytes, Tag>::Finalizer* FrameArena<Bytes, Tag>::finalizers_ = nullptr;
+
+}
+
+#endif //ADVLIB_ADVARENA_H
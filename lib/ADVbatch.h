@@ -0,0 +1,95 @@
+/**
+ * ADVbatch - Callbacks called once for a batch of items
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVBATCH_H
+#define ADVLIB_ADVBATCH_H
+
+#include "ADVstd.h"
+#include "ADVcallback.h"
+
+namespace adv
+{
+
+// A pointer and a number of items. It does not own the items.
+template<typename T>
+struct Span
+{
+    constexpr Span() noexcept = default;
+    constexpr Span(T* data, size_t size) noexcept: data_{data}, size_{size} {}
+    template<size_t N>
+    constexpr Span(T (&items)[N]) noexcept: data_{items}, size_{N} {}
+
+    constexpr T* data() const noexcept { return data_; }
+    constexpr size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0; }
+    constexpr T* begin() const noexcept { return data_; }
+    constexpr T* end() const noexcept { return data_ + size_; }
+    constexpr T& operator[](size_t i) const noexcept { return data_[i]; }
+
+    // The items from position offset, up to count items
+    constexpr Span subspan(size_t offset, size_t count) const noexcept
+        { return Span{data_ + offset, count < size_ - offset ? count : size_ - offset}; }
+
+private:
+    T* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// A callback receiving items by batches: one indirect call per batch instead of one per item
+template<typename T, size_t Size = CALLBACK_SIZE, size_t Align = CALLBACK_ALIGN, typename Overflow = NoOverflow>
+using BatchCallback = Callback<void(*)(Span<T>), Size, Align, Overflow>;
+
+// --------------------------------------------------------------------
+// Call a scalar callable for each item of a batch. The loop and the
+// callable are compiled together in the invoker of the callback, so the
+// callable can be inlined and the loop vectorized.
+// --------------------------------------------------------------------
+
+template<typename F>
+struct ForEach
+{
+    template<typename U> explicit ForEach(U&& f): f_(forward<U>(f)) {}
+
+    template<typename T>
+    void operator()(Span<T> items)
+    {
+        T* data = items.data();
+        for(size_t i = 0, n = items.size(); i < n; ++i) f_(data[i]);
+    }
+
+private:
+    F f_;
+};
+
+// Lift a scalar callable: BatchCallback<const int>{for_each([](int sample){ ... })}
+template<typename F>
+ForEach<typename decay<F>::type> for_each(F&& f) { return ForEach<typename decay<F>::type>{forward<F>(f)}; }
+
+// Send items to a batch callback by batches of up to n items (all at once if n is 0)
+template<typename T, typename C>
+void dispatch_by(size_t n, Span<T> items, C& callback)
+{
+    if(n == 0) n = items.size();
+    for(size_t offset = 0; offset < items.size(); offset += n) callback(items.subspan(offset, n));
+}
+
+}
+
+#endif //ADVLIB_ADVBATCH_H
@@ -0,0 +1,116 @@
+/**
+ * ADVbind - Binding of the leading arguments of a callable
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVBIND_H
+#define ADVLIB_ADVBIND_H
+
+#include "ADVstd.h"
+
+namespace adv
+{
+
+namespace internal
+{
+    // Object of a member function call, from a pointer or a reference
+    template<typename O> auto object_of(O&& o, true_type) -> decltype(*o) { return *o; }
+    template<typename O> O&& object_of(O&& o, false_type) { return forward<O>(o); }
+
+    // Call a callable or a member function (the object being the first argument)
+    template<typename F, typename... Args>
+    auto invoke(F&& f, Args&&... args) -> decltype(forward<F>(f)(forward<Args>(args)...))
+        { return forward<F>(f)(forward<Args>(args)...); }
+
+    template<typename M, typename C, typename O, typename... Args>
+    auto invoke(M C::* m, O&& o, Args&&... args)
+        -> decltype((object_of(forward<O>(o), is_pointer<typename remove_reference<O>::type>{}).*m)(forward<Args>(args)...))
+        { return (object_of(forward<O>(o), is_pointer<typename remove_reference<O>::type>{}).*m)(forward<Args>(args)...); }
+
+    // One bound value. Empty types take no space (Empty Base Optimization).
+    template<size_t I, typename T, bool Ebo = is_empty<T>::value && !is_final<T>::value>
+    struct BoundValue
+    {
+        template<typename U> explicit BoundValue(U&& u): value_(forward<U>(u)) {}
+        T& get() { return value_; }
+        const T& get() const { return value_; }
+    private:
+        T value_;
+    };
+
+    template<size_t I, typename T>
+    struct BoundValue<I, T, true>: private T
+    {
+        template<typename U> explicit BoundValue(U&& u): T(forward<U>(u)) {}
+        T& get() { return *this; }
+        const T& get() const { return *this; }
+    };
+
+    template<typename Indices, typename... T>
+    struct BoundValues;
+
+    template<size_t... I, typename... T>
+    struct BoundValues<index_sequence<I...>, T...>: BoundValue<I, T>...
+    {
+        template<typename... U> explicit BoundValues(U&&... u): BoundValue<I, T>(forward<U>(u))... {}
+    };
+}
+
+// --------------------------------------------------------------------
+// A callable and its leading arguments. The callable and the arguments
+// are stored by value, side by side, and empty types take no space.
+// The stored arguments are passed as lvalues, without intermediate copies.
+// --------------------------------------------------------------------
+
+template<typename F, typename... Args>
+struct BindFront: private internal::BoundValues<make_index_sequence<sizeof...(Args) + 1>, F, Args...>
+{
+    template<typename G, typename... U>
+    explicit BindFront(G&& f, U&&... args): Base(forward<G>(f), forward<U>(args)...) {}
+
+    template<typename... Call>
+    auto operator()(Call&&... call) -> decltype(internal::invoke(declval<F&>(), declval<Args&>()..., forward<Call>(call)...))
+        { return call_(make_index_sequence<sizeof...(Args)>{}, forward<Call>(call)...); }
+
+    template<typename... Call>
+    auto operator()(Call&&... call) const -> decltype(internal::invoke(declval<const F&>(), declval<const Args&>()..., forward<Call>(call)...))
+        { return call_(make_index_sequence<sizeof...(Args)>{}, forward<Call>(call)...); }
+
+private:
+    using Base = internal::BoundValues<make_index_sequence<sizeof...(Args) + 1>, F, Args...>;
+    template<size_t I, typename T> using Value = internal::BoundValue<I, T>;
+
+    template<size_t... I, typename... Call>
+    decltype(auto) call_(index_sequence<I...>, Call&&... call)
+        { return internal::invoke(static_cast<Value<0, F>&>(*this).get(), static_cast<Value<I + 1, Args>&>(*this).get()..., forward<Call>(call)...); }
+
+    template<size_t... I, typename... Call>
+    decltype(auto) call_(index_sequence<I...>, Call&&... call) const
+        { return internal::invoke(static_cast<const Value<0, F>&>(*this).get(), static_cast<const Value<I + 1, Args>&>(*this).get()..., forward<Call>(call)...); }
+};
+
+// Bind the leading arguments of a callable or of a member function (the first argument being the object)
+template<typename F, typename... Args>
+BindFront<typename decay<F>::type, typename decay<Args>::type...> bind_front(F&& f, Args&&... args)
+{
+    return BindFront<typename decay<F>::type, typename decay<Args>::type...>{forward<F>(f), forward<Args>(args)...};
+}
+
+}
+
+#endif //ADVLIB_ADVBIND_H
@@ -22,6 +22,10 @@
 #define ADV_CALLBACKS_H
 
 #include "ADVstd.h"
+#include "ADVbind.h"
+#ifdef ADV_PROFILE_CALLBACKS
+#include "ADVprofiler.h"
+#endif
 
 namespace adv
 {
@@ -34,13 +38,275 @@ namespace internal
             auto p = reinterpret_cast<const char*>(&i);
             copy(p, p + sizeof(I), reinterpret_cast<char*>(o));
     }
+
+    // Operations implemented by the manager of a target stored inside a Callback
+    enum class Operation { Clone, Move, Destroy };
+
+    // Copy (clone), move and destroy a target of type T. One manager per type of target.
+    // When Copyable is false, the target is never cloned (and may be move-only).
+    template<typename T, bool Copyable>
+    struct Manager
+    {
+        static bool manage(Operation op, void* dest, void* src)
+        {
+            switch(op)
+            {
+                case Operation::Clone:   return clone(bool_constant<Copyable>{}, dest, src);
+                case Operation::Move:    new(dest) T(move(*static_cast<T*>(src))); static_cast<T*>(src)->~T(); break;
+                case Operation::Destroy: static_cast<T*>(dest)->~T(); break;
+            }
+            return true;
+        }
+
+    private:
+        static bool clone(true_type, void* dest, const void* src) { new(dest) T(*static_cast<const T*>(src)); return true; }
+        static bool clone(false_type, void*, const void*) { return false; }
+    };
+
+    // Call a target of type T. One invoker per type of target.
+    template<typename T, typename R, typename...A>
+    struct Invoker
+    {
+        static R invoke(void* data, A&&...args) { return (*static_cast<T*>(data))(forward<A>(args)...); }
+    };
+
+    // Invoker of empty callbacks: it does nothing and returns a default value.
+    // Calling an empty callback is thus not a special case.
+    template<typename R, typename...A>
+    struct NullInvoker
+    {
+        static R invoke(void*, A&&...) { return R(); }
+    };
+}
+
+// --------------------------------------------------------------------
+// Overflow policies: where targets too large for the inline storage are stored
+// --------------------------------------------------------------------
+
+// Targets have to fit inside the callback (default)
+struct NoOverflow
+{
+    static const bool enabled = false;
+    static void* allocate(size_t) { return nullptr; }
+    static void deallocate(void*) {}
+};
+
+// Targets are allocated with operator new
+struct HeapOverflow
+{
+    static const bool enabled = true;
+    static void* allocate(size_t size) { return ::operator new(size, std::nothrow); }
+    static void deallocate(void* p) { ::operator delete(p); }
+};
+
+// Targets are allocated from a Pool such as FixedBlockPool
+template<typename Pool>
+struct PoolOverflow
+{
+    static const bool enabled = true;
+    static void* allocate(size_t size) { return Pool::allocate(size); }
+    static void deallocate(void* p) { Pool::deallocate(p); }
+};
+
+// Targets are allocated from an Arena such as FrameArena and live until the arena is reset.
+// Callbacks do not destroy their targets: the arena runs the destructors that are not trivial.
+template<typename Arena>
+struct ArenaOverflow
+{
+    static const bool enabled = true;
+    static const bool owns_targets = true;
+    static void* allocate(size_t size) { return Arena::allocate(size); }
+    static void deallocate(void*) {}
+    template<typename T> static bool adopt(T* target) { return Arena::destroy_at_reset(target); }
+};
+
+// Statistics about the targets stored out of line with a given policy
+template<typename Overflow>
+struct OverflowStats
+{
+    static size_t count;   // Number of targets stored out of line, including copies
+    static size_t live;    // Number of targets currently stored out of line
+    static size_t largest; // Size of the largest target stored out of line
+    static size_t failed;  // Number of failed allocations
+    static void reset() { count = live = largest = failed = 0; }
+};
+
+template<typename Overflow> size_t OverflowStats<Overflow>::count = 0;
+template<typename Overflow> size_t OverflowStats<Overflow>::live = 0;
+template<typename Overflow> size_t OverflowStats<Overflow>::largest = 0;
+template<typename Overflow> size_t OverflowStats<Overflow>::failed = 0;
+
+namespace internal
+{
+    // Copy the storage of a target. Shared by all the targets and signatures.
+    inline void copy_bytes(void* dest, const void* src, size_t size)
+    {
+        auto from = static_cast<const unsigned char*>(src);
+        copy(from, from + size, static_cast<unsigned char*>(dest));
+    }
+
+    // Allocate and free the storage of targets stored out of line, and keep the statistics
+    template<typename Overflow>
+    struct OverflowStorage
+    {
+        using Stats = OverflowStats<Overflow>;
+
+        static void* allocate(size_t size)
+        {
+            void* p = reserve(size);
+            if(p != nullptr) commit(size);
+            return p;
+        }
+
+        static void deallocate(void* p)
+        {
+            Overflow::deallocate(p);
+            --Stats::live;
+        }
+
+        // Allocate without counting a stored target yet: commit or discard it after
+        static void* reserve(size_t size)
+        {
+            void* p = Overflow::allocate(size);
+            if(p == nullptr) ++Stats::failed;
+            return p;
+        }
+
+        static void commit(size_t size)
+        {
+            ++Stats::count;
+            ++Stats::live;
+            if(size > Stats::largest) Stats::largest = size;
+        }
+
+        static void discard(void* p)
+        {
+            Overflow::deallocate(p);
+            ++Stats::failed;
+        }
+    };
+
+    // Does the Overflow policy destroy the targets itself (owns_targets)?
+    template<typename Overflow, typename = void>
+    struct owns_targets: false_type {};
+    template<typename Overflow>
+    struct owns_targets<Overflow, enable_if_t<Overflow::owns_targets>>: true_type {};
+
+    // Create, copy (clone) and destroy a target of type T stored out of line.
+    // The inline storage only contains a pointer to the target.
+    template<typename T, typename Overflow, bool Copyable>
+    struct OverflowManager
+    {
+        template<typename... Args>
+        static bool create(void* data, Args&&... args)
+        {
+            void* p = OverflowStorage<Overflow>::reserve(sizeof(T));
+            if(p == nullptr) return false;
+            T* target = new(p) T{forward<Args>(args)...};
+            if(!adopt(owns_targets<Overflow>{}, target))
+            {
+                target->~T();
+                OverflowStorage<Overflow>::discard(p);
+                return false;
+            }
+            OverflowStorage<Overflow>::commit(sizeof(T));
+            *static_cast<T**>(data) = target;
+            return true;
+        }
+
+        static bool manage(Operation op, void* dest, void* src)
+        {
+            switch(op)
+            {
+                case Operation::Clone: return clone(bool_constant<Copyable>{}, dest, src);
+                case Operation::Move: *static_cast<T**>(dest) = *static_cast<T**>(src); break;
+                case Operation::Destroy:
+                {
+                    T* target = *static_cast<T**>(dest);
+                    if(!owns_targets<Overflow>::value) target->~T();
+                    OverflowStorage<Overflow>::deallocate(target);
+                    break;
+                }
+            }
+            return true;
+        }
+
+    private:
+        // Register the destructor of the target with policies owning the targets
+        static bool adopt(false_type, T*) { return true; }
+        static bool adopt(true_type, T* target) { return is_trivially_destructible<T>::value || Overflow::adopt(target); }
+
+        static bool clone(true_type, void* dest, const void* src) { return create(dest, **static_cast<T* const*>(src)); }
+        static bool clone(false_type, void*, const void*) { return false; }
+    };
+
+    // Copy and destroy any trivially copyable target of TargetSize bytes stored out of line:
+    // one manager per size instead of one per target.
+    template<size_t TargetSize, typename Overflow>
+    struct TrivialOverflowManager
+    {
+        static bool manage(Operation op, void* dest, void* src)
+        {
+            switch(op)
+            {
+                case Operation::Clone:
+                {
+                    void* p = OverflowStorage<Overflow>::allocate(TargetSize);
+                    if(p == nullptr) return false;
+                    copy_bytes(p, *static_cast<void* const*>(src), TargetSize);
+                    *static_cast<void**>(dest) = p;
+                    break;
+                }
+                case Operation::Move: *static_cast<void**>(dest) = *static_cast<void**>(src); break;
+                case Operation::Destroy: OverflowStorage<Overflow>::deallocate(*static_cast<void**>(dest)); break;
+            }
+            return true;
+        }
+    };
+
+    // Call a target of type T stored out of line
+    template<typename T, typename R, typename...A>
+    struct OverflowInvoker
+    {
+        static R invoke(void* data, A&&...args) { return (**static_cast<T**>(data))(forward<A>(args)...); }
+    };
+
+    // Targets (i.e. what is stored inside a Callback)
+
+    template<typename R, typename...A>
+    struct Function
+    {
+        using FP = R(*)(A...);
+        R operator()(A&&...args) const { return function_(forward<A>(args)...); }
+        FP function_;
+    };
+
+    template<typename O, typename R, typename...A>
+    struct Method
+    {
+        using MP = R(O::*)(A...);
+        R operator()(A&&...args) const { return (object_->*method_)(forward<A>(args)...); }
+        O* object_;
+        MP method_;
+    };
+
+    template<typename O, typename R, typename...A>
+    struct ConstMethod
+    {
+        using MP = R(O::*)(A...) const;
+        R operator()(A&&...args) const { return (object_->*method_)(forward<A>(args)...); }
+        const O* object_;
+        MP method_;
+    };
 }
 
+// Virtual interface of callables. Callbacks no longer use it (see Invoker and Manager)
+// but it is kept for code deriving from it.
 template<typename R, typename...A>
 struct Callable
 {
     virtual void clone(void* dest) const = 0;
-    virtual R operator()(A&&...args) const = 0;
+    virtual R operator()(A...args) const = 0;
     virtual ~Callable() = default;
 };
 
@@ -53,7 +319,7 @@ struct CallableFunctor: public Callable<R, A...>
     explicit CallableFunctor(F f): functor_{f} {}
     void clone(void* dest) const override { internal::copy_data(functor_, dest); }
 
-    R operator()(A&&...args) const override { if(is_void<R>::value) functor_(forward<A>(args)...);
+    R operator()(A...args) const override { if(is_void<R>::value) functor_(forward<A>(args)...);
         else return functor_(forward<A>(args)...); }
 
 private:
@@ -71,7 +337,7 @@ struct CallableFunction: public Callable<R, A...>
     explicit CallableFunction(FP f): function_{f} {}
     void clone(void* dest) const override { internal::copy_data(function_, dest); }
 
-    R operator()(A&&...args) const override { if(is_void<R>::value) function_(forward<A>(args)...);
+    R operator()(A...args) const override { if(is_void<R>::value) function_(forward<A>(args)...);
         else return function_(forward<A>(args)...); }
 
 private:
@@ -88,7 +354,7 @@ struct CallableMethod: public Callable<R, A...>
     CallableMethod(O& o, MP m): f_{o, m} {}
     void clone(void* dest) const override { internal::copy_data(f_, dest); }
 
-    R operator()(A&&...args) const override { if(is_void<R>::value) (f_.object_.*f_.method_)(forward<A>(args)...);
+    R operator()(A...args) const override { if(is_void<R>::value) (f_.object_.*f_.method_)(forward<A>(args)...);
         else return (f_.object_.*f_.method_)(forward<A>(args)...); }
 
 private:
@@ -105,77 +371,280 @@ struct CallableConstMethod: public Callable<R, A...>
     CallableConstMethod(const O& o, MP m): f_{o, m} {}
     void clone(void* dest) const override { internal::copy_data(f_, dest); }
 
-    R operator()(A&&...args) const override { if(is_void<R>::value) (f_.object_.*f_.method_)(forward<A>(args)...);
+    R operator()(A...args) const override { if(is_void<R>::value) (f_.object_.*f_.method_)(forward<A>(args)...);
         else return (f_.object_.*f_.method_)(forward<A>(args)...); }
 
 private:
     struct fields { const O& object_; MP method_; } f_{};
 };
 
-template<typename>
+// Default size and alignment of the storage inside callbacks
+static const size_t CALLBACK_SIZE = 32;
+static const size_t CALLBACK_ALIGN = alignof(void*);
+
+namespace internal
+{
+    // Storage and dispatch shared by Callback and UniqueCallback.
+    // Targets that are trivially copyable have no manager: they are copied and moved byte by byte.
+    template<bool Copyable, size_t Size, size_t Align, typename Overflow, typename R, typename... A>
+    struct CallbackBase
+    {
+        static_assert(Size >= sizeof(void*), "Buffer is too small to hold a pointer");
+        static_assert(Align > 0 && (Align & (Align - 1)) == 0, "Alignment has to be a power of two");
+
+        // Call. Arguments are taken as declared by the signature and forwarded to the target without copies.
+        // Like a pointer, a const callback can be called: the target is not part of its constness.
+        R operator()(A... args) const
+        {
+#ifdef ADV_PROFILE_CALLBACKS
+            // Empty callbacks have no target and are not profiled
+            if(invoker_ != null_invoker())
+            {
+                CallbackProfiler::Scope scope{reinterpret_cast<CallbackProfiler::Identity>(invoker_), target()};
+                return invoker_(buffer_, forward<A>(args)...);
+            }
+#endif
+            return invoker_(buffer_, forward<A>(args)...);
+        }
+
+        // Boolean
+        explicit operator bool() const noexcept { return invoker_ != null_invoker(); }
+
+        // Same function, same object and member function, or same trivially copyable target stored inline.
+        // Other targets are only equal to themselves.
+        bool operator==(const CallbackBase& other) const noexcept
+        {
+            if(invoker_ != other.invoker_) return false;
+            if(invoker_ == null_invoker()) return true;
+            if(manager_ != nullptr || other.manager_ != nullptr) return this == &other;
+            return equal(buffer_, buffer_ + Size, other.buffer_);
+        }
+
+        bool operator!=(const CallbackBase& other) const noexcept { return !(*this == other); }
+
+        // Equal callbacks have the same hash
+        size_t hash() const noexcept
+        {
+            size_t h = hash_bytes(&invoker_, sizeof(invoker_));
+            return invoker_ == null_invoker() ? h : hash_bytes(buffer_, Size, h);
+        }
+
+        // Is a target of type T stored inline?
+        template<typename T>
+        static constexpr bool fits() { return sizeof(T) <= Size && alignof(T) <= Align; }
+
+    protected:
+        using InvokerFunction = R(*)(void*, A&&...);
+        using ManagerFunction = bool(*)(Operation, void*, void*);
+
+        CallbackBase() noexcept = default;
+        ~CallbackBase() { reset(); }
+
+        void copy_from(const CallbackBase& cb)
+        {
+            if(cb.manager_ != nullptr) { if(!cb.manager_(Operation::Clone, buffer_, cb.buffer_)) return; }
+            else if(cb.invoker_ != null_invoker()) copy_buffer(cb.buffer_); // The buffer of an empty callback is not initialized
+            invoker_ = cb.invoker_;
+            manager_ = cb.manager_;
+        }
+
+        void move_from(CallbackBase& cb)
+        {
+            if(cb.manager_ != nullptr) cb.manager_(Operation::Move, buffer_, cb.buffer_);
+            else if(cb.invoker_ != null_invoker()) copy_buffer(cb.buffer_);
+            invoker_ = cb.invoker_;
+            manager_ = cb.manager_;
+            cb.invoker_ = null_invoker();
+            cb.manager_ = nullptr;
+        }
+
+        void reset()
+        {
+            if(manager_ != nullptr) manager_(Operation::Destroy, buffer_, nullptr);
+            invoker_ = null_invoker();
+            manager_ = nullptr;
+        }
+
+        template<typename T, typename... Args> void place(Args&&... args)
+        {
+            place<T>(bool_constant<fits<T>()>{}, forward<Args>(args)...);
+        }
+
+    private:
+        static constexpr InvokerFunction null_invoker() { return &NullInvoker<R, A...>::invoke; }
+        void copy_buffer(const unsigned char* from) { copy_bytes(buffer_, from, Size); }
+
+#ifdef ADV_PROFILE_CALLBACKS
+        // First word of the storage: the function, the object or the captures
+        const void* target() const
+        {
+            const void* t = nullptr;
+            copy(buffer_, buffer_ + sizeof(t), reinterpret_cast<unsigned char*>(&t));
+            return t;
+        }
+#endif
+
+        // Target stored inline
+        template<typename T, typename... Args> void place(true_type, Args&&... args)
+        {
+            fill(buffer_, buffer_ + Size, 0); // Unused bytes and padding are compared
+            new(buffer_) T{forward<Args>(args)...};
+            invoker_ = &Invoker<T, R, A...>::invoke;
+            manager_ = is_trivially_copyable<T>::value ? nullptr : &Manager<T, Copyable>::manage;
+        }
+
+        // Target stored out of line. If the allocation fails, the callback is empty.
+        template<typename T, typename... Args> void place(false_type, Args&&... args)
+        {
+            static_assert(Overflow::enabled, "Buffer is too small or not enough aligned");
+            static_assert(alignof(T) <= alignof(max_align_t), "Target is over-aligned");
+            static_assert(alignof(T*) <= Align, "Buffer is not enough aligned");
+            using OM = OverflowManager<T, Overflow, Copyable>;
+            if(!OM::create(buffer_, forward<Args>(args)...)) return;
+            invoker_ = &OverflowInvoker<T, R, A...>::invoke;
+            manager_ = is_trivially_copyable<T>::value ? &TrivialOverflowManager<sizeof(T), Overflow>::manage : &OM::manage;
+        }
+
+    private:
+        InvokerFunction invoker_ = null_invoker();
+        ManagerFunction manager_ = nullptr;
+        alignas(Align) mutable unsigned char buffer_[Size]; // Mutable: see operator()
+    };
+}
+
+// A Callback stores its target inline in a buffer of Size bytes, aligned on Align bytes.
+// Targets too large for this buffer are stored according to the Overflow policy.
+template<typename Sig, size_t Size = CALLBACK_SIZE, size_t Align = CALLBACK_ALIGN, typename Overflow = NoOverflow>
 struct Callback;
 
-template <typename R, typename... A>
-struct Callback<R(*)(A...)>
+template <typename R, typename... A, size_t Size, size_t Align, typename Overflow>
+struct Callback<R(*)(A...), Size, Align, Overflow>: internal::CallbackBase<true, Size, Align, Overflow, R, A...>
 {
     using FP = R(*)(A...);
-    using Self = Callback<R(*)(A...)>;
+    using Self = Callback<R(*)(A...), Size, Align, Overflow>;
 
     // Empty callback
     Callback() noexcept = default;
     explicit Callback(nullptr_t) noexcept {}
 
     // From a function
-    explicit Callback(FP f): isNull_{false} { place<CallableFunction<R, A...>>(f); }
+    explicit Callback(FP f) { this->template place<internal::Function<R, A...>>(f); }
 
     // From a member function and object reference
     template <typename O>
-    Callback(O& o, R(O::*m)(A...)): isNull_{false}  { place<CallableMethod<O, R, A...>>(o, m); }
+    Callback(O& o, R(O::*m)(A...)) { this->template place<internal::Method<O, R, A...>>(&o, m); }
 
     // From a member function and object pointer
     template <typename O>
-    Callback(O* o, R(O::*m)(A...)): isNull_{false}  { place<CallableMethod<O, R, A...>>(*o, m); }
+    Callback(O* o, R(O::*m)(A...)) { this->template place<internal::Method<O, R, A...>>(o, m); }
 
     // From a const member function and object reference
     template <typename O>
-    Callback(const O& o, R(O::*m)(A...)): isNull_{false}  { place<CallableConstMethod<O, R, A...>>(o, m); }
+    Callback(const O& o, R(O::*m)(A...) const) { this->template place<internal::ConstMethod<O, R, A...>>(&o, m); }
 
     // From a const member function and object pointer
     template <typename O>
-    Callback(const O* o, R(O::*m)(A...)): isNull_{false}  { place<CallableConstMethod<O, R, A...>>(*o, m); }
+    Callback(const O* o, R(O::*m)(A...) const) { this->template place<internal::ConstMethod<O, R, A...>>(o, m); }
+
+    // From a member function, an object pointer and the leading arguments of the member function
+    template <typename O, typename M, typename B, typename... Bs>
+    Callback(O* o, M O::* m, B&& b, Bs&&... bs)
+        { this->template place<BindFront<M O::*, O*, typename decay<B>::type, typename decay<Bs>::type...>>(m, o, forward<B>(b), forward<Bs>(bs)...); }
+
+    // From a member function, an object reference and the leading arguments of the member function
+    template <typename O, typename M, typename B, typename... Bs>
+    Callback(O& o, M O::* m, B&& b, Bs&&... bs): Callback(&o, m, forward<B>(b), forward<Bs>(bs)...) {}
 
     // Captured lambda specialization
     template<typename L>
-    explicit Callback(const L& l): isNull_{false}  { place<CallableFunctor<L, R, A...>>(l); }
+    explicit Callback(const L& l) { this->template place<L>(l); }
 
     // From another Callback
-    Callback(const Self& cb): isNull_{cb.isNull_}  { copy_buffer(cb.buffer_); }
+    Callback(const Self& cb) { this->copy_from(cb); }
+    Callback(Self&& cb) noexcept { this->move_from(cb); }
 
     // Assignment
-    Callback& operator=(const Self& cb) { if(&cb != this) { isNull_ = cb.isNull_;  copy_buffer(cb.buffer_); } return *this; };
-    Callback& operator=(nullptr_t) { isNull_ = true; return *this; }
+    Callback& operator=(const Self& cb) { if(&cb != this) { this->reset(); this->copy_from(cb); } return *this; };
+    Callback& operator=(Self&& cb) noexcept { if(&cb != this) { this->reset(); this->move_from(cb); } return *this; };
+    Callback& operator=(nullptr_t) { this->reset(); return *this; }
+};
+
+// A move-only Callback. Its target can be move-only (for example a lambda owning a unique_ptr).
+template<typename Sig, size_t Size = CALLBACK_SIZE, size_t Align = CALLBACK_ALIGN, typename Overflow = NoOverflow>
+struct UniqueCallback;
 
-    // Call
-    R operator()(A&&... args)
-        { if(is_void<R>::value) { if(!isNull_) (*callable())(forward<A>(args)...); }
-          else { return !isNull_ ? (*callable())(forward<A>(args)...) : R(); } }
+template <typename R, typename... A, size_t Size, size_t Align, typename Overflow>
+struct UniqueCallback<R(*)(A...), Size, Align, Overflow>: internal::CallbackBase<false, Size, Align, Overflow, R, A...>
+{
+    using FP = R(*)(A...);
+    using Self = UniqueCallback<R(*)(A...), Size, Align, Overflow>;
 
-    // Boolean
-    explicit operator bool() const noexcept { return !isNull_; }
+    // Empty callback
+    UniqueCallback() noexcept = default;
+    explicit UniqueCallback(nullptr_t) noexcept {}
 
-private:
-    void copy_buffer(const char* from) { copy(from, from + BUFFER_SIZE, buffer_); }
-    Callable<R, A...>* callable() { return reinterpret_cast<Callable<R, A...>*>(buffer_); }
+    // From a function
+    explicit UniqueCallback(FP f) { this->template place<internal::Function<R, A...>>(f); }
 
-    template<typename T, typename... Args> void place(Args&&... args)
-    { static_assert(sizeof(T) <= BUFFER_SIZE, "Buffer is too small"); new(buffer_) T(forward<Args>(args)...); }
+    // From a member function and object reference
+    template <typename O>
+    UniqueCallback(O& o, R(O::*m)(A...)) { this->template place<internal::Method<O, R, A...>>(&o, m); }
 
-private:
-    static const size_t BUFFER_SIZE = 32;
-    char buffer_[BUFFER_SIZE] = {};
-    bool isNull_ = true;
+    // From a member function and object pointer
+    template <typename O>
+    UniqueCallback(O* o, R(O::*m)(A...)) { this->template place<internal::Method<O, R, A...>>(o, m); }
+
+    // From a const member function and object reference
+    template <typename O>
+    UniqueCallback(const O& o, R(O::*m)(A...) const) { this->template place<internal::ConstMethod<O, R, A...>>(&o, m); }
+
+    // From a const member function and object pointer
+    template <typename O>
+    UniqueCallback(const O* o, R(O::*m)(A...) const) { this->template place<internal::ConstMethod<O, R, A...>>(o, m); }
+
+    // From a member function, an object pointer and the leading arguments of the member function
+    template <typename O, typename M, typename B, typename... Bs>
+    UniqueCallback(O* o, M O::* m, B&& b, Bs&&... bs)
+        { this->template place<BindFront<M O::*, O*, typename decay<B>::type, typename decay<Bs>::type...>>(m, o, forward<B>(b), forward<Bs>(bs)...); }
+
+    // From a member function, an object reference and the leading arguments of the member function
+    template <typename O, typename M, typename B, typename... Bs>
+    UniqueCallback(O& o, M O::* m, B&& b, Bs&&... bs): UniqueCallback(&o, m, forward<B>(b), forward<Bs>(bs)...) {}
+
+    // From a lambda or a functor, moved inside the callback
+    template<typename L>
+    explicit UniqueCallback(L l) { this->template place<L>(move(l)); }
+
+    // From another UniqueCallback
+    UniqueCallback(Self&& cb) noexcept { this->move_from(cb); }
+
+    // Assignment
+    UniqueCallback& operator=(Self&& cb) noexcept { if(&cb != this) { this->reset(); this->move_from(cb); } return *this; };
+    UniqueCallback& operator=(nullptr_t) { this->reset(); return *this; }
+
+    // Disabled
+    UniqueCallback(const Self&) = delete;
+    UniqueCallback& operator=(const Self&) = delete;
 };
 
+// Properties of the storage of a Callback
+template<typename CB>
+struct callback_traits;
+
+template <typename R, typename... A, size_t Size, size_t Align, typename Overflow>
+struct callback_traits<Callback<R(*)(A...), Size, Align, Overflow>>
+{
+    using overflow = Overflow;
+    static constexpr size_t storage_size = Size;    // Bytes available for a target
+    static constexpr size_t storage_align = Align;  // Alignment of the target
+    static constexpr size_t footprint = sizeof(Callback<R(*)(A...), Size, Align, Overflow>); // Bytes used by a Callback
+    static constexpr size_t overhead = footprint - Size; // Bytes not used by the target
+};
+
+template <typename R, typename... A, size_t Size, size_t Align, typename Overflow>
+struct callback_traits<UniqueCallback<R(*)(A...), Size, Align, Overflow>>:
+    callback_traits<Callback<R(*)(A...), Size, Align, Overflow>> {};
+
 }
 
 #endif // ADV_CALLBACKS_H
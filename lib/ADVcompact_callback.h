@@ -0,0 +1,142 @@
+/**
+ * ADVcompact_callback - Callbacks two words wide
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVCOMPACT_CALLBACK_H
+#define ADVLIB_ADVCOMPACT_CALLBACK_H
+
+#include "ADVstd.h"
+#include "ADVcallback.h"
+
+namespace adv
+{
+
+namespace internal
+{
+    // A member function known at compile-time and an object: only the object is stored
+    template<typename O, typename R, typename M, M m, typename... A>
+    struct BoundMethod
+    {
+        R operator()(A&&...args) const { return (object_->*m)(forward<A>(args)...); }
+        O* object_;
+    };
+}
+
+// --------------------------------------------------------------------
+// A CompactCallback is an invoker and one word of storage: a function,
+// an object bound to a member function known at compile-time, or a
+// trivially copyable functor not larger than a pointer (such as a lambda
+// without capture or capturing one pointer). The invoker is also the tag
+// telling what is stored, so no destructor and no manager are needed.
+// Calls are the same as with Callback.
+// --------------------------------------------------------------------
+
+template<typename Sig>
+struct CompactCallback;
+
+template<typename R, typename... A>
+struct CompactCallback<R(*)(A...)>
+{
+    using FP = R(*)(A...);
+    using Self = CompactCallback<R(*)(A...)>;
+
+    // Empty callback
+    CompactCallback() noexcept = default;
+    explicit CompactCallback(nullptr_t) noexcept {}
+
+    // From a function
+    explicit CompactCallback(FP f) noexcept { place<internal::Function<R, A...>>(f); }
+
+    // From a small trivially copyable functor
+    template<typename L>
+    explicit CompactCallback(const L& l) noexcept
+    {
+        static_assert(fits<L>(), "Functor is too large, not enough aligned or not trivially copyable");
+        place<L>(l);
+    }
+
+    // From a member function known at compile-time and an object
+    template<typename O, R(O::*M)(A...)>
+    static Self bind(O& o) noexcept
+    {
+        Self self;
+        self.template place<internal::BoundMethod<O, R, R(O::*)(A...), M, A...>>(&o);
+        return self;
+    }
+
+    // From a const member function known at compile-time and an object
+    template<typename O, R(O::*M)(A...) const>
+    static Self bind(const O& o) noexcept
+    {
+        Self self;
+        self.template place<internal::BoundMethod<const O, R, R(O::*)(A...) const, M, A...>>(&o);
+        return self;
+    }
+
+    Self& operator=(nullptr_t) noexcept { invoker_ = null_invoker(); return *this; }
+
+    // Call. Arguments are forwarded to the target without copies.
+    R operator()(A... args) const { return invoker_(buffer_, forward<A>(args)...); }
+
+    // Boolean
+    explicit operator bool() const noexcept { return invoker_ != null_invoker(); }
+
+    // Same function, same object and member function, or same functor
+    bool operator==(const Self& other) const noexcept
+    {
+        if(invoker_ != other.invoker_) return false;
+        return invoker_ == null_invoker() || equal(buffer_, buffer_ + sizeof(buffer_), other.buffer_);
+    }
+
+    bool operator!=(const Self& other) const noexcept { return !(*this == other); }
+
+    // Equal callbacks have the same hash
+    size_t hash() const noexcept
+    {
+        size_t h = internal::hash_bytes(&invoker_, sizeof(invoker_));
+        return invoker_ == null_invoker() ? h : internal::hash_bytes(buffer_, sizeof(buffer_), h);
+    }
+
+    // Can a target of type T be stored?
+    template<typename T>
+    static constexpr bool fits()
+    {
+        return sizeof(T) <= sizeof(void*) && alignof(T) <= alignof(void*) && is_trivially_copyable<T>::value;
+    }
+
+private:
+    using InvokerFunction = R(*)(void*, A&&...);
+
+    static constexpr InvokerFunction null_invoker() { return &internal::NullInvoker<R, A...>::invoke; }
+
+    template<typename T, typename... Args> void place(Args&&... args)
+    {
+        fill(buffer_, buffer_ + sizeof(buffer_), 0); // Unused bytes and padding are compared
+        new(buffer_) T{forward<Args>(args)...};
+        invoker_ = &internal::Invoker<T, R, A...>::invoke;
+    }
+
+private:
+    InvokerFunction invoker_ = null_invoker();
+    alignas(void*) mutable unsigned char buffer_[sizeof(void*)]; // Called even when const, as Callback
+};
+
+}
+
+#endif //ADVLIB_ADVCOMPACT_CALLBACK_H
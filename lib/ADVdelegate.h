@@ -0,0 +1,141 @@
+/**
+ * ADVdelegate - Callbacks bound at compile-time
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVDELEGATE_H
+#define ADVLIB_ADVDELEGATE_H
+
+#include "ADVstd.h"
+
+namespace adv
+{
+
+// --------------------------------------------------------------------
+// A Delegate is an object pointer and a static thunk. The function or the
+// member function is a template parameter, so it is not stored and the
+// compiler can inline it inside the thunk. It does not own the object.
+// Delegates are constexpr-constructible: a table of delegates declared
+// constexpr is initialized at compile-time and can live in read-only memory.
+// --------------------------------------------------------------------
+
+template<typename Sig>
+struct Delegate;
+
+template<typename R, typename... A>
+struct Delegate<R(*)(A...)>
+{
+    using FP = R(*)(A...);
+    using Self = Delegate<R(*)(A...)>;
+
+    // Empty delegate
+    constexpr Delegate() noexcept: thunk_{&call_nothing}, data_{static_cast<void*>(nullptr)} {}
+    constexpr Delegate(nullptr_t) noexcept: Delegate{} {}
+
+    // From a function
+    constexpr explicit Delegate(FP f) noexcept: thunk_{&call_pointer}, data_{f} {}
+
+    // From a lambda without capture (constexpr only with C++ 17)
+    template<typename L, typename = enable_if_t<is_convertible<const L&, FP>::value>>
+    constexpr explicit Delegate(const L& l) noexcept: Delegate{static_cast<FP>(l)} {}
+
+    // From a function known at compile-time
+    template<R(*F)(A...)>
+    static constexpr Self bind() noexcept { return Self{&call_function<F>, nullptr}; }
+
+    // From a member function known at compile-time and an object
+    template<typename O, R(O::*M)(A...)>
+    static constexpr Self bind(O& o) noexcept { return Self{&call_method<O, M>, &o}; }
+
+    // From a const member function known at compile-time and an object
+    template<typename O, R(O::*M)(A...) const>
+    static constexpr Self bind(const O& o) noexcept { return Self{&call_const_method<O, M>, const_cast<O*>(&o)}; }
+
+#ifdef __cpp_nontype_template_parameter_auto
+    // From a member function known at compile-time and an object: bind<&O::m>(o) (C++ 17)
+    template<auto M, typename O>
+    static constexpr Self bind(O& o) noexcept { return Self{&call_member<O, M>, const_cast<typename remove_cv<O>::type*>(&o)}; }
+#endif
+
+    Self& operator=(nullptr_t) noexcept { thunk_ = &call_nothing; data_.object = nullptr; return *this; }
+
+    // Call
+    R operator()(A... args) const { return thunk_(data_, forward<A>(args)...); }
+
+    // Boolean
+    explicit operator bool() const noexcept { return thunk_ != &call_nothing; }
+
+    // Same thunk and same object or function
+    bool operator==(const Self& other) const noexcept
+    {
+        if(thunk_ != other.thunk_) return false;
+        return thunk_ == &call_nothing || equal(bytes(), bytes() + sizeof(Data), other.bytes());
+    }
+
+    bool operator!=(const Self& other) const noexcept { return !(*this == other); }
+
+    // Equal delegates have the same hash
+    size_t hash() const noexcept
+    {
+        size_t h = internal::hash_bytes(&thunk_, sizeof(thunk_));
+        return thunk_ == &call_nothing ? h : internal::hash_bytes(&data_, sizeof(Data), h);
+    }
+
+private:
+    // The object or the function
+    union Data
+    {
+        constexpr Data(void* object): object{object} {}
+        constexpr Data(FP function): function{function} {}
+        void* object;
+        FP function;
+    };
+
+    using Thunk = R(*)(Data, A&&...);
+
+    constexpr Delegate(Thunk thunk, void* object) noexcept: thunk_{thunk}, data_{object} {}
+
+    const unsigned char* bytes() const noexcept { return reinterpret_cast<const unsigned char*>(&data_); }
+
+    // Thunk of empty delegates
+    static R call_nothing(Data, A&&...) { return R(); }
+
+    static R call_pointer(Data data, A&&... args) { return data.function(forward<A>(args)...); }
+
+    template<R(*F)(A...)>
+    static R call_function(Data, A&&... args) { return F(forward<A>(args)...); }
+
+    template<typename O, R(O::*M)(A...)>
+    static R call_method(Data data, A&&... args) { return (static_cast<O*>(data.object)->*M)(forward<A>(args)...); }
+
+    template<typename O, R(O::*M)(A...) const>
+    static R call_const_method(Data data, A&&... args) { return (static_cast<const O*>(data.object)->*M)(forward<A>(args)...); }
+
+#ifdef __cpp_nontype_template_parameter_auto
+    template<typename O, auto M>
+    static R call_member(Data data, A&&... args) { return (static_cast<O*>(data.object)->*M)(forward<A>(args)...); }
+#endif
+
+private:
+    Thunk thunk_;
+    Data data_;
+};
+
+}
+
+#endif //ADVLIB_ADVDELEGATE_H
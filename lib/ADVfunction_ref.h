@@ -0,0 +1,104 @@
+/**
+ * ADVfunction_ref - Non-owning references to callables
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVFUNCTION_REF_H
+#define ADVLIB_ADVFUNCTION_REF_H
+
+#include "ADVstd.h"
+
+namespace adv
+{
+
+// --------------------------------------------------------------------
+// A reference to a callable: two pointers (the object and a thunk).
+// It does not own the callable, so the callable has to outlive it.
+// Use it for parameters of functions calling a callable synchronously:
+// a temporary (such as a lambda) passed as an argument lives until the
+// call returns, but a FunctionRef initialized with a temporary dangles.
+// --------------------------------------------------------------------
+
+template<typename Sig>
+struct FunctionRef;
+
+template<typename R, typename... A>
+struct FunctionRef<R(*)(A...)>
+{
+    using FP = R(*)(A...);
+    using Self = FunctionRef<R(*)(A...)>;
+
+private:
+    // Can T be called with A... and its result converted to R?
+    template<typename T, typename = void>
+    struct callable: false_type {};
+    template<typename T>
+    struct callable<T, void_t<decltype(declval<T&>()(declval<A>()...))>>:
+        bool_constant<is_void<R>::value || is_convertible<decltype(declval<T&>()(declval<A>()...)), R>::value> {};
+
+public:
+    // From a function
+    FunctionRef(FP f) noexcept: thunk_{&call_function} { data_.function = reinterpret_cast<void(*)()>(f); }
+
+    // From a callable (lambda, functor, Callback, ...). Only a reference to f is kept:
+    // f has to outlive this FunctionRef, even when it is a temporary.
+    template<typename F, typename = enable_if_t<!is_same<typename remove_cv<typename remove_reference<F>::type>::type, Self>::value
+                                                && callable<typename remove_reference<F>::type>::value>>
+    FunctionRef(F&& f) noexcept: thunk_{&call_object<typename remove_reference<F>::type>}
+        { data_.object = const_cast<void*>(static_cast<const void*>(&f)); }
+
+    // From a member function known at compile-time and an object
+    template<typename O, R(O::*M)(A...)>
+    static Self bind(O& o) noexcept { return Self{&call_method<O, M>, &o}; }
+
+    // From a const member function known at compile-time and an object
+    template<typename O, R(O::*M)(A...) const>
+    static Self bind(const O& o) noexcept { return Self{&call_const_method<O, M>, const_cast<O*>(&o)}; }
+
+    // Call
+    R operator()(A... args) const { return thunk_(data_, forward<A>(args)...); }
+
+private:
+    union Data { void* object; void (*function)(); };
+    using Thunk = R(*)(Data, A&&...);
+
+    FunctionRef(Thunk thunk, void* object) noexcept: thunk_{thunk} { data_.object = object; }
+
+    static R call_function(Data data, A&&... args)
+        { return reinterpret_cast<FP>(data.function)(forward<A>(args)...); }
+
+    template<typename T>
+    static R call_object(Data data, A&&... args)
+        { return (*static_cast<T*>(data.object))(forward<A>(args)...); }
+
+    template<typename O, R(O::*M)(A...)>
+    static R call_method(Data data, A&&... args)
+        { return (static_cast<O*>(data.object)->*M)(forward<A>(args)...); }
+
+    template<typename O, R(O::*M)(A...) const>
+    static R call_const_method(Data data, A&&... args)
+        { return (static_cast<const O*>(data.object)->*M)(forward<A>(args)...); }
+
+private:
+    Data data_;
+    Thunk thunk_;
+};
+
+}
+
+#endif //ADVLIB_ADVFUNCTION_REF_H
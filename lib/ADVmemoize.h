@@ -0,0 +1,226 @@
+/**
+ * ADVmemoize - Callbacks remembering their last results
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVMEMOIZE_H
+#define ADVLIB_ADVMEMOIZE_H
+
+#include "ADVstd.h"
+#include "ADVcallback.h"
+
+namespace adv
+{
+
+// Hash of an argument of a memoized callback. By default, the bytes of trivially
+// copyable types are hashed. Specialize it for other types.
+template<typename T>
+struct MemoHash
+{
+    static size_t hash(const T& value, size_t seed)
+    {
+        static_assert(is_trivially_copyable<T>::value, "Specialize MemoHash for this type");
+        return internal::hash_bytes(&value, sizeof(T), seed);
+    }
+};
+
+namespace internal
+{
+    // The arguments of a call, stored by value
+    template<size_t I, typename T>
+    struct MemoKeyPart { T value_{}; };
+
+    template<typename Indices, typename... T>
+    struct MemoKey;
+
+    template<size_t... I, typename... T>
+    struct MemoKey<index_sequence<I...>, T...>: MemoKeyPart<I, T>...
+    {
+        MemoKey() = default;
+        explicit MemoKey(const T&... values): MemoKeyPart<I, T>{values}... {}
+
+        bool equals(const T&... values) const
+        {
+            bool same[] = {true, (static_cast<const MemoKeyPart<I, T>&>(*this).value_ == values)...};
+            for(bool s: same) if(!s) return false;
+            return true;
+        }
+
+        static size_t hash(const T&... values)
+        {
+            size_t h = 2166136261u;
+            size_t hashes[] = {h, (h = MemoHash<T>::hash(values, h))...};
+            (void)hashes;
+            return h;
+        }
+    };
+}
+
+// --------------------------------------------------------------------
+// A callable remembering the results of the last N calls of a target,
+// keyed on the arguments. Results are found with an open-addressed hash
+// table (linear probing, at most half full) and the least recently used
+// one is replaced when the cache is full. Nothing is allocated.
+// The target has to be a pure function of its arguments.
+// --------------------------------------------------------------------
+
+template<size_t N, typename Sig, typename Target = Callback<Sig>>
+struct Memoize;
+
+template<size_t N, typename R, typename... A, typename Target>
+struct Memoize<N, R(*)(A...), Target>
+{
+    static_assert(!is_void<R>::value, "Only results can be memoized");
+
+    using Index = typename uint_for<N>::type;
+
+    explicit Memoize(const Target& target): target_(target) { clear(); }
+
+    // Return the remembered result, or call the target and remember its result
+    R operator()(A... args)
+    {
+        size_t h = Key::hash(args...);
+        for(size_t i = h & MASK; buckets_[i] != NONE; i = (i + 1) & MASK)
+        {
+            Entry& entry = entries_[buckets_[i]];
+            if(entry.hash_ == h && entry.key_.equals(args...))
+            {
+                ++hits_;
+                touch(buckets_[i]);
+                return entry.value_;
+            }
+        }
+
+        ++misses_;
+        Key key{args...}; // Before the call, since the target may take the arguments
+        R value = target_(forward<A>(args)...);
+        remember(h, key, value);
+        return value;
+    }
+
+    // Forget all the results
+    void clear()
+    {
+        fill(buckets_, buckets_ + BUCKETS, static_cast<Index>(N));
+        count_ = 0;
+        first_ = last_ = NONE;
+    }
+
+    size_t hits() const noexcept { return hits_; }
+    size_t misses() const noexcept { return misses_; }
+    void reset_statistics() noexcept { hits_ = misses_ = 0; }
+
+    size_t size() const noexcept { return count_; }
+    static constexpr size_t capacity() noexcept { return N; }
+
+private:
+    using Key = internal::MemoKey<make_index_sequence<sizeof...(A)>, typename decay<A>::type...>;
+
+    static constexpr size_t buckets(size_t n) { size_t b = 1; while(b < 2 * n) b *= 2; return b; }
+    static constexpr size_t BUCKETS = buckets(N);
+    static constexpr size_t MASK = BUCKETS - 1;
+    static constexpr Index NONE = static_cast<Index>(N);
+
+    struct Entry
+    {
+        Key key_;
+        R value_{};
+        size_t hash_ = 0;
+        Index previous_ = NONE; // More recently used
+        Index next_ = NONE;     // Less recently used
+    };
+
+    void remember(size_t h, const Key& key, const R& value)
+    {
+        Index index;
+        if(count_ < N) index = static_cast<Index>(count_++);
+        else { index = last_; unlink(index); forget(index); }
+
+        Entry& entry = entries_[index];
+        entry.key_ = key;
+        entry.value_ = value;
+        entry.hash_ = h;
+        link_first(index);
+
+        size_t i = h & MASK;
+        while(buckets_[i] != NONE) i = (i + 1) & MASK;
+        buckets_[i] = index;
+    }
+
+    // Remove an entry from the hash table and shift back the following ones
+    void forget(Index index)
+    {
+        size_t hole = entries_[index].hash_ & MASK;
+        while(buckets_[hole] != index) hole = (hole + 1) & MASK;
+        for(size_t i = (hole + 1) & MASK; buckets_[i] != NONE; i = (i + 1) & MASK)
+        {
+            size_t home = entries_[buckets_[i]].hash_ & MASK;
+            if(((i - home) & MASK) >= ((i - hole) & MASK)) { buckets_[hole] = buckets_[i]; hole = i; }
+        }
+        buckets_[hole] = NONE;
+    }
+
+    // Make an entry the most recently used
+    void touch(Index index)
+    {
+        if(index == first_) return;
+        unlink(index);
+        link_first(index);
+    }
+
+    void link_first(Index index)
+    {
+        Entry& entry = entries_[index];
+        entry.previous_ = NONE;
+        entry.next_ = first_;
+        if(first_ != NONE) entries_[first_].previous_ = index;
+        first_ = index;
+        if(last_ == NONE) last_ = index;
+    }
+
+    void unlink(Index index)
+    {
+        Entry& entry = entries_[index];
+        if(entry.previous_ != NONE) entries_[entry.previous_].next_ = entry.next_; else first_ = entry.next_;
+        if(entry.next_ != NONE) entries_[entry.next_].previous_ = entry.previous_; else last_ = entry.previous_;
+    }
+
+private:
+    Target target_;
+    Entry entries_[N];
+    Index buckets_[BUCKETS];
+    size_t count_ = 0;
+    Index first_ = NONE; // Most recently used
+    Index last_ = NONE;  // Least recently used
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+};
+
+template<size_t N, typename R, typename... A, typename Target>
+constexpr size_t Memoize<N, R(*)(A...), Target>::BUCKETS;
+
+// Remember the results of the last N calls of a callback: memoize<16>(callback)
+template<size_t N, typename R, typename... A, size_t Size, size_t Align, typename Overflow>
+Memoize<N, R(*)(A...), Callback<R(*)(A...), Size, Align, Overflow>> memoize(const Callback<R(*)(A...), Size, Align, Overflow>& callback)
+{
+    return Memoize<N, R(*)(A...), Callback<R(*)(A...), Size, Align, Overflow>>{callback};
+}
+
+}
+
+#endif //ADVLIB_ADVMEMOIZE_H
@@ -0,0 +1,163 @@
+/**
+ * ADVobserver - Intrusive observers disconnected automatically
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVOBSERVER_H
+#define ADVLIB_ADVOBSERVER_H
+
+#include "ADVstd.h"
+#include "ADVcallback.h"
+
+namespace adv
+{
+
+template<typename Sig, typename Slot = Callback<Sig>>
+struct Subject;
+
+// --------------------------------------------------------------------
+// A slot and the node linking it to a Subject, embedded in the observer:
+//
+//    struct Display
+//    {
+//        Display(Subject<void(*)(int)>& s) { s.connect(changed_); }
+//        void refresh(int value);
+//        Observer<void(*)(int)> changed_{this, &Display::refresh};
+//    };
+//
+// When the observer is destroyed, it is disconnected in O(1): the node
+// keeps the address of the pointer pointing to it and its subject, to move
+// forward the cursors of the emissions in progress. An Observer is neither
+// copyable nor movable since the Subject points to it.
+// --------------------------------------------------------------------
+
+template<typename Sig, typename Slot = Callback<Sig>>
+struct Observer
+{
+    template<typename... Args>
+    explicit Observer(Args&&... args): slot_{forward<Args>(args)...} {}
+    ~Observer() { disconnect(); }
+
+    Observer(const Observer&) = delete;
+    Observer& operator=(const Observer&) = delete;
+
+    bool connected() const noexcept { return previous_ != nullptr; }
+
+    void disconnect() noexcept
+    {
+        if(previous_ == nullptr) return;
+        subject_->skip(*this);
+        *previous_ = next_;
+        if(next_ != nullptr) next_->previous_ = previous_;
+        next_ = nullptr;
+        previous_ = nullptr;
+        subject_ = nullptr;
+    }
+
+private:
+    friend Subject<Sig, Slot>;
+
+    Slot slot_;
+    Observer* next_ = nullptr;
+    Observer** previous_ = nullptr; // The pointer pointing to this node (head or next of the previous node)
+    Subject<Sig, Slot>* subject_ = nullptr;
+};
+
+// --------------------------------------------------------------------
+// A singly linked list of Observers. Connect and disconnect (with
+// Observer::disconnect) are O(1) and never allocate. The last observer connected is the first called.
+// While the subject emits, any observer can be disconnected or destroyed:
+// each emission keeps the next observer to call and a disconnection moves it
+// forward. Observers connected while the subject emits are not called.
+// --------------------------------------------------------------------
+
+template<typename R, typename... A, typename Slot>
+struct Subject<R(*)(A...), Slot>
+{
+    using Node = Observer<R(*)(A...), Slot>;
+
+    Subject() noexcept = default;
+    ~Subject() { clear(); }
+
+    Subject(const Subject&) = delete;
+    Subject& operator=(const Subject&) = delete;
+
+    // Connect an observer, disconnecting it first from its current subject (if any)
+    void connect(Node& node) noexcept
+    {
+        node.disconnect();
+        node.next_ = head_;
+        node.previous_ = &head_;
+        node.subject_ = this;
+        if(head_ != nullptr) head_->previous_ = &node.next_;
+        head_ = &node;
+    }
+
+    // Disconnect all the observers
+    void clear() noexcept { while(head_ != nullptr) head_->disconnect(); }
+
+    // Call all the connected observers
+    void emit(A... args)
+    {
+        Emission emission{head_, emission_};
+        emission_ = &emission;
+        while(emission.next_to_call_ != nullptr)
+        {
+            Node* node = emission.next_to_call_;
+            emission.next_to_call_ = node->next_;
+            node->slot_(static_cast<A>(args)...);
+        }
+        emission_ = emission.outer_;
+    }
+
+    void operator()(A... args) { emit(static_cast<A>(args)...); }
+
+    bool empty() const noexcept { return head_ == nullptr; }
+
+    // Number of connected observers (linear)
+    size_t size() const noexcept
+    {
+        size_t n = 0;
+        for(Node* node = head_; node != nullptr; node = node->next_) ++n;
+        return n;
+    }
+
+private:
+    friend Node;
+
+    // An emission in progress, nested if an observer emits again
+    struct Emission
+    {
+        Node* next_to_call_;
+        Emission* outer_;
+    };
+
+    // Called before the node is unlinked
+    void skip(const Node& node) noexcept
+    {
+        for(Emission* emission = emission_; emission != nullptr; emission = emission->outer_)
+            if(emission->next_to_call_ == &node) emission->next_to_call_ = node.next_;
+    }
+
+    Node* head_ = nullptr;
+    Emission* emission_ = nullptr;
+};
+
+}
+
+#endif //ADVLIB_ADVOBSERVER_H
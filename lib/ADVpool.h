@@ -0,0 +1,94 @@
+/**
+ * ADVpool - Pool of fixed-size blocks allocated statically
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVPOOL_H
+#define ADVLIB_ADVPOOL_H
+
+#include "ADVstd.h"
+
+namespace adv
+{
+
+// --------------------------------------------------------------------
+// Count blocks of BlockSize bytes, allocated statically.
+// Tag is used to declare several pools with the same geometry.
+// Allocation and deallocation are O(1). This is not interrupt-safe.
+// --------------------------------------------------------------------
+
+template<size_t BlockSize, size_t Count, typename Tag = void>
+struct FixedBlockPool
+{
+    static const size_t block_size = BlockSize;
+    static const size_t block_count = Count;
+
+    // Return nullptr if the size is too large or if the pool is exhausted
+    static void* allocate(size_t size)
+    {
+        if(size > BlockSize) return nullptr;
+
+        Block* block = free_;
+        if(block != nullptr) free_ = block->next_;
+        else if(unused_ < Count) block = &blocks_[unused_++];
+        else return nullptr;
+
+        ++used_;
+        return block->data_;
+    }
+
+    static void deallocate(void* p)
+    {
+        if(p == nullptr) return;
+        auto block = static_cast<Block*>(p);
+        block->next_ = free_;
+        free_ = block;
+        --used_;
+    }
+
+    // Number of blocks currently allocated
+    static size_t used() { return used_; }
+
+private:
+    union Block
+    {
+        Block* next_;
+        alignas(max_align_t) unsigned char data_[BlockSize];
+    };
+
+    static Block blocks_[Count];
+    static Block* free_;
+    static size_t unused_;
+    static size_t used_;
+};
+
+template<size_t BlockSize, size_t Count, typename Tag>
+typename FixedBlockPool<BlockSize, Count, Tag>::Block FixedBlockPool<BlockSize, Count, Tag>::blocks_[Count];
+
+template<size_t BlockSize, size_t Count, typename Tag>
+typename FixedBlockPool<BlockSize, Count, Tag>::Block* FixedBlockPool<BlockSize, Count, Tag>::free_ = nullptr;
+
+template<size_t BlockSize, size_t Count, typename Tag>
+size_t FixedBlockPool<BlockSize, Count, Tag>::unused_ = 0;
+
+template<size_t BlockSize, size_t Count, typename Tag>
+size_t FixedBlockPool<BlockSize, Count, Tag>::used_ = 0;
+
+}
+
+#endif //ADVLIB_ADVPOOL_H
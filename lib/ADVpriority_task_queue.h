@@ -0,0 +1,220 @@
+/**
+ * ADVpriority_task_queue - Queue of deferred tasks ordered by priority
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVPRIORITY_TASK_QUEUE_H
+#define ADVLIB_ADVPRIORITY_TASK_QUEUE_H
+
+#include "ADVstd.h"
+#include "ADVcallback.h"
+
+namespace adv
+{
+
+// --------------------------------------------------------------------
+// Up to N tasks run by decreasing priority, and in the order they were
+// posted for the same priority. Tasks stay in place; a 4-ary heap of
+// (priority, sequence, slot) entries orders them, so post, run_next,
+// cancel and change_priority are O(log N) and never move a task.
+// This is not interrupt-safe.
+// --------------------------------------------------------------------
+
+template<size_t N, typename T = Callback<void(*)()>, typename Priority = unsigned char>
+struct PriorityTaskQueue
+{
+    using Task = T;
+    using Index = typename uint_for<N>::type;
+
+    // Handle of a posted task
+    struct Handle
+    {
+        Handle() = default;
+        explicit operator bool() const noexcept { return slot_ != NONE; }
+    private:
+        friend PriorityTaskQueue;
+        Handle(Index slot, unsigned char generation): slot_{slot}, generation_{generation} {}
+        Index slot_ = NONE;
+        unsigned char generation_ = 0;
+    };
+
+    PriorityTaskQueue() noexcept
+    {
+        for(size_t i = 0; i < N; ++i)
+        {
+            heap_[i].slot_ = static_cast<Index>(i); // Free slots are kept after the heap
+            positions_[i] = NONE;
+        }
+    }
+
+    // Add a task. The higher the priority, the sooner it runs. Return an invalid handle if the queue is full.
+    Handle post(Priority priority, const T& task)
+    {
+        if(size_ >= N) return Handle{};
+        Index position = static_cast<Index>(size_++);
+        Entry& entry = heap_[position];
+        entry.priority_ = priority;
+        entry.sequence_ = sequence_++;
+        tasks_[entry.slot_] = task;
+        positions_[entry.slot_] = position;
+        Index slot = entry.slot_;
+        sift_up(position);
+        return Handle{slot, generations_[slot]};
+    }
+
+    // Change the priority of a task not yet run. It keeps its place among the tasks of its new priority.
+    bool change_priority(const Handle& handle, Priority priority)
+    {
+        if(!pending(handle)) return false;
+        Index position = positions_[handle.slot_];
+        Priority previous = heap_[position].priority_;
+        heap_[position].priority_ = priority;
+        if(priority > previous) sift_up(position); else sift_down(position);
+        return true;
+    }
+
+    // Remove a task not yet run. The handle is invalid after.
+    bool cancel(Handle& handle)
+    {
+        if(!pending(handle)) return false;
+        remove(positions_[handle.slot_]);
+        handle = Handle{};
+        return true;
+    }
+
+    // Is the task of this handle waiting to run?
+    bool pending(const Handle& handle) const noexcept
+    {
+        return handle && positions_[handle.slot_] != NONE && generations_[handle.slot_] == handle.generation_;
+    }
+
+    // Run the task with the highest priority. Return false if the queue is empty.
+    bool run_next()
+    {
+        if(size_ == 0) return false;
+        T task{move(tasks_[heap_[0].slot_])};
+        remove(0); // Before running, so the task can post tasks
+        task();
+        return true;
+    }
+
+    // Run up to max_tasks tasks, by priority. Tasks posted while running may run if they have a higher priority.
+    size_t run_pending(size_t max_tasks = N)
+    {
+        size_t pending = size_ < max_tasks ? size_ : max_tasks;
+        size_t ran = 0;
+        while(ran < pending && run_next()) ++ran;
+        return ran;
+    }
+
+    // Priority of the next task to run (the queue must not be empty)
+    Priority top_priority() const noexcept { return heap_[0].priority_; }
+
+    void clear() { while(size_ > 0) remove(static_cast<Index>(size_ - 1)); }
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    bool full() const noexcept { return size_ >= N; }
+    static constexpr size_t capacity() noexcept { return N; }
+
+private:
+    static const Index NONE = static_cast<Index>(N);
+    static const size_t ARITY = 4;
+
+    struct Entry
+    {
+        Priority priority_{};
+        unsigned long sequence_ = 0;
+        Index slot_ = NONE;
+    };
+
+    // Does a run before b? Sequences are allowed to wrap.
+    static bool before(const Entry& a, const Entry& b)
+    {
+        if(a.priority_ != b.priority_) return a.priority_ > b.priority_;
+        return static_cast<unsigned long>(b.sequence_ - a.sequence_ - 1) < ~0UL / 2;
+    }
+
+    void place(Index position, const Entry& entry)
+    {
+        heap_[position] = entry;
+        positions_[entry.slot_] = position;
+    }
+
+    void sift_up(Index position)
+    {
+        Entry entry = heap_[position];
+        while(position > 0)
+        {
+            Index parent = static_cast<Index>((position - 1) / ARITY);
+            if(!before(entry, heap_[parent])) break;
+            place(position, heap_[parent]);
+            position = parent;
+        }
+        place(position, entry);
+    }
+
+    void sift_down(Index position)
+    {
+        Entry entry = heap_[position];
+        for(;;)
+        {
+            size_t first = position * ARITY + 1;
+            if(first >= size_) break;
+            size_t last = first + ARITY < size_ ? first + ARITY : size_;
+            size_t best = first;
+            for(size_t child = first + 1; child < last; ++child)
+                if(before(heap_[child], heap_[best])) best = child;
+            if(!before(heap_[best], entry)) break;
+            place(position, heap_[best]);
+            position = static_cast<Index>(best);
+        }
+        place(position, entry);
+    }
+
+    // Remove the entry at this position and free its slot
+    void remove(Index position)
+    {
+        Index slot = heap_[position].slot_;
+        tasks_[slot] = nullptr;
+        positions_[slot] = NONE;
+        ++generations_[slot]; // Invalidate the handles of this slot
+
+        Index last = static_cast<Index>(--size_);
+        if(position != last)
+        {
+            Entry moved = heap_[last];
+            Entry removed = heap_[position];
+            place(position, moved);
+            if(before(moved, removed)) sift_up(position); else sift_down(position);
+        }
+        heap_[last].slot_ = slot;
+    }
+
+private:
+    T tasks_[N];
+    Entry heap_[N];          // The heap, then the free slots
+    Index positions_[N];     // Position in the heap of each slot, NONE if free
+    unsigned char generations_[N] = {};
+    unsigned long sequence_ = 0;
+    size_t size_ = 0;
+};
+
+}
+
+#endif //ADVLIB_ADVPRIORITY_TASK_QUEUE_H
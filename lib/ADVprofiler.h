@@ -0,0 +1,185 @@
+/**
+ * ADVprofiler - Invocation profiler for callbacks
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVPROFILER_H
+#define ADVLIB_ADVPROFILER_H
+
+#include "ADVstd.h"
+
+// Number of distinct targets recorded when callbacks are profiled (ADV_PROFILE_CALLBACKS)
+#ifndef ADV_PROFILE_ENTRIES
+#define ADV_PROFILE_ENTRIES 64
+#endif
+
+#if !defined(__i386__) && !defined(__x86_64__) && defined(__STDC_HOSTED__) && __STDC_HOSTED__ == 1 && defined(__unix__)
+#include <time.h>
+#define ADV_PROFILE_CLOCK_GETTIME 1
+#endif
+
+namespace adv
+{
+
+using ProfileTicks = unsigned long long;
+
+namespace internal
+{
+    // Time stamp counter on x86, monotonic nanoseconds on other hosts.
+    // Elsewhere, there is no default tick source: use set_clock.
+    inline ProfileTicks default_ticks()
+    {
+#if defined(__i386__) || defined(__x86_64__)
+        return __builtin_ia32_rdtsc();
+#elif defined(ADV_PROFILE_CLOCK_GETTIME)
+        timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<ProfileTicks>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+#else
+        return 0;
+#endif
+    }
+}
+
+// --------------------------------------------------------------------
+// Invocation counts and cumulative ticks of up to N targets (N is a power
+// of two), kept in a static open-addressed table. A target is identified
+// by its invoker and by the first word of its storage (the function, the
+// object or the captures). Ticks are inclusive of nested invocations.
+// Targets recorded once the table is full are only counted as dropped.
+// This is not interrupt-safe.
+// --------------------------------------------------------------------
+
+template<size_t N, typename Tag = void>
+struct InvocationProfiler
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "Capacity has to be a power of two");
+
+    using Identity = void(*)();
+    using Clock = ProfileTicks(*)();
+
+    struct Entry
+    {
+        Identity invoker;
+        const void* target;
+        unsigned long count;
+        ProfileTicks ticks;
+    };
+
+    // Measure the lifetime of this object
+    struct Scope
+    {
+        Scope(Identity invoker, const void* target): invoker_{invoker}, target_{target}, start_{clock_()} {}
+        ~Scope() { record(invoker_, target_, clock_() - start_); }
+
+    private:
+        Identity invoker_;
+        const void* target_;
+        ProfileTicks start_;
+    };
+
+    // Replace the tick source (for example a cycle counter or micros on a board)
+    static void set_clock(Clock clock) { clock_ = clock != nullptr ? clock : &internal::default_ticks; }
+
+    static void record(Identity invoker, const void* target, ProfileTicks ticks)
+    {
+        Entry* entry = find(invoker, target);
+        if(entry == nullptr) { ++dropped_; return; }
+        ++entry->count;
+        entry->ticks += ticks;
+    }
+
+    // Copy the (up to) n entries with the most ticks into out, in descending order. Return how many were copied.
+    static size_t top(Entry* out, size_t n)
+    {
+        size_t copied = 0;
+        if(n == 0) return 0;
+        for(size_t i = 0; i < N; ++i)
+        {
+            const Entry& entry = entries_[i];
+            if(entry.count == 0) continue;
+            if(copied == n && out[n - 1].ticks >= entry.ticks) continue;
+            size_t j = copied < n ? copied++ : n - 1;
+            for(; j > 0 && out[j - 1].ticks < entry.ticks; --j) out[j] = out[j - 1];
+            out[j] = entry;
+        }
+        return copied;
+    }
+
+    // Number of distinct targets recorded
+    static size_t size() { return size_; }
+    static constexpr size_t capacity() { return N; }
+    // Number of invocations not recorded because the table was full
+    static unsigned long dropped() { return dropped_; }
+
+    static void reset()
+    {
+        for(size_t i = 0; i < N; ++i) entries_[i] = Entry{};
+        size_ = 0;
+        dropped_ = 0;
+    }
+
+private:
+    static Entry* find(Identity invoker, const void* target)
+    {
+        size_t i = hash(invoker, target);
+        for(size_t probe = 0; probe < N; ++probe, i = (i + 1) & (N - 1))
+        {
+            Entry& entry = entries_[i];
+            if(entry.count == 0)
+            {
+                entry.invoker = invoker;
+                entry.target = target;
+                ++size_;
+                return &entry;
+            }
+            if(entry.invoker == invoker && entry.target == target) return &entry;
+        }
+        return nullptr;
+    }
+
+    static size_t hash(Identity invoker, const void* target)
+    {
+        auto h = reinterpret_cast<size_t>(invoker) ^ (reinterpret_cast<size_t>(target) * 31);
+        return (h ^ (h >> 4) ^ (h >> 9)) & (N - 1);
+    }
+
+    static Entry entries_[N];
+    static size_t size_;
+    static unsigned long dropped_;
+    static Clock clock_;
+};
+
+template<size_t N, typename Tag>
+typename InvocationProfiler<N, Tag>::Entry InvocationProfiler<N, Tag>::entries_[N];
+
+template<size_t N, typename Tag>
+size_t InvocationProfiler<N, Tag>::size_ = 0;
+
+template<size_t N, typename Tag>
+unsigned long InvocationProfiler<N, Tag>::dropped_ = 0;
+
+template<size_t N, typename Tag>
+typename InvocationProfiler<N, Tag>::Clock InvocationProfiler<N, Tag>::clock_ = &internal::default_ticks;
+
+// The profiler used by Callback and UniqueCallback when ADV_PROFILE_CALLBACKS is defined
+using CallbackProfiler = InvocationProfiler<ADV_PROFILE_ENTRIES>;
+
+}
+
+#endif //ADVLIB_ADVPROFILER_H
@@ -0,0 +1,118 @@
+/**
+ * ADVresumable - Stackless resumable tasks
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVRESUMABLE_H
+#define ADVLIB_ADVRESUMABLE_H
+
+#include "ADVstd.h"
+#include "ADVcrtp.h"
+#include "ADVcallback.h"
+
+// --------------------------------------------------------------------
+// Stackless resumable tasks (Duff's device). The body of resume() is
+// written as straight-line code between ADV_BEGIN and ADV_END and is
+// compiled to a switch on the line where it was suspended:
+//
+//    struct Heat: adv::Resumable<Heat>
+//    {
+//        bool resume()
+//        {
+//            ADV_BEGIN();
+//            heater_on();
+//            ADV_AWAIT(temperature() >= target_);
+//            display("Ready");
+//            ADV_END();
+//        }
+//    };
+//
+// resume() returns true while the task is not finished. Local variables
+// are not preserved across ADV_YIELD and ADV_AWAIT: use data members.
+// ADV_YIELD and ADV_AWAIT can not be used inside another switch.
+// --------------------------------------------------------------------
+
+// The first evaluation of the condition of ADV_AWAIT falls through to its case label
+#if defined(__has_attribute)
+#if __has_attribute(fallthrough)
+#define ADV_FALLTHROUGH __attribute__((fallthrough))
+#endif
+#endif
+#ifndef ADV_FALLTHROUGH
+#define ADV_FALLTHROUGH do {} while(0)
+#endif
+
+#define ADV_BEGIN() switch(this->line_) { case 0:
+#define ADV_YIELD() do { this->line_ = __LINE__; return true; case __LINE__:; } while(0)
+#define ADV_AWAIT(condition) do { this->line_ = __LINE__; ADV_FALLTHROUGH; case __LINE__: if(!(condition)) return true; } while(0)
+#define ADV_END() } this->line_ = adv::internal::RESUMABLE_FINISHED; return false
+
+namespace adv
+{
+
+namespace internal
+{
+    static constexpr unsigned int RESUMABLE_FINISHED = static_cast<unsigned int>(-1);
+
+    template<typename Queue, typename T> void resume_in(Queue& queue, T& task);
+}
+
+template<typename Queue, typename T> bool start_in(Queue& queue, T& task);
+
+template<typename Self>
+struct Resumable: Crtp<Self, Resumable>
+{
+    // The task has run to its end
+    bool finished() const noexcept { return line_ == internal::RESUMABLE_FINISHED; }
+    // Restart the task from its beginning
+    void restart() noexcept { line_ = 0; }
+    // The task is not finished but it is not scheduled anymore: its queue was full. start_in schedules it again.
+    bool stalled() const noexcept { return stalled_; }
+
+protected:
+    unsigned int line_ = 0; // Where the task is suspended
+
+private:
+    template<typename Queue, typename T> friend void internal::resume_in(Queue& queue, T& task);
+    template<typename Queue, typename T> friend bool start_in(Queue& queue, T& task);
+
+    bool stalled_ = false;
+};
+
+namespace internal
+{
+    template<typename Queue, typename T>
+    void resume_in(Queue& queue, T& task)
+    {
+        if(task.resume()) start_in(queue, task);
+    }
+}
+
+// Run a task from a queue of Callbacks (such as TaskQueue): it is resumed
+// each time the queue runs its pending tasks, until it is finished.
+// If the queue is full, the task is stalled and false is returned.
+template<typename Queue, typename T>
+bool start_in(Queue& queue, T& task)
+{
+    task.stalled_ = !queue.post(typename Queue::Task{[&queue, &task]{ internal::resume_in(queue, task); }});
+    return !task.stalled_;
+}
+
+}
+
+#endif //ADVLIB_ADVRESUMABLE_H
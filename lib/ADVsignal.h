@@ -0,0 +1,300 @@
+/**
+ * ADVsignal - Fixed-capacity multicast signals
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVSIGNAL_H
+#define ADVLIB_ADVSIGNAL_H
+
+#include "ADVstd.h"
+#include "ADVcallback.h"
+
+namespace adv
+{
+
+// --------------------------------------------------------------------
+// Combiners of the results of the slots of a Signal
+// --------------------------------------------------------------------
+
+// Keep the result of the last slot called
+template<typename R>
+struct LastResult
+{
+    void operator()(const R& r) { result = r; }
+    R result{};
+};
+
+// Sum the results of all the slots
+template<typename R>
+struct SumResults
+{
+    void operator()(const R& r) { result += r; }
+    R result{};
+};
+
+// --------------------------------------------------------------------
+// A Signal calls up to N slots (Callbacks by default).
+// Slots are stored contiguously: emit only iterates over the connected slots.
+// Connect and disconnect are O(1) and never allocate. When a slot is
+// disconnected, the last slot takes its place, so the order of the calls
+// is not the order of the connections.
+// Slots are also indexed by their hash (open addressing, linear probing),
+// so a slot can be disconnected by value, without its connection.
+// A slot can connect or disconnect slots (itself included) while it is called:
+// disconnected slots are emptied (so calling them does nothing) unless they
+// are running, and they are removed after emit.
+// --------------------------------------------------------------------
+
+template<typename Sig, size_t N, typename Slot = Callback<Sig>>
+struct Signal;
+
+template<typename R, typename... A, size_t N, typename Slot>
+struct Signal<R(*)(A...), N, Slot>
+{
+    using Index = typename uint_for<N>::type;
+
+    // Handle of a connected slot
+    struct Connection
+    {
+        Connection() noexcept: id_{static_cast<Index>(N)} {} // Invalid
+        explicit operator bool() const noexcept { return id_ < N; }
+    private:
+        friend Signal;
+        Connection(Index id, unsigned char generation): id_{id}, generation_{generation} {}
+        Index id_;
+        unsigned char generation_ = 0;
+    };
+
+    Signal() noexcept
+    {
+        for(size_t i = 0; i < N; ++i) ids_[i] = positions_[i] = static_cast<Index>(i);
+        fill(index_, index_ + BUCKETS, static_cast<Index>(N));
+    }
+
+    // Connect a slot. Return an invalid connection if the signal is full.
+    Connection connect(const Slot& slot)
+    {
+        if(count_ >= N) return Connection{};
+        Index id = ids_[count_];
+        slots_[count_] = slot;
+        add_to_index(count_++);
+        return Connection{id, generations_[id]};
+    }
+
+    // Disconnect a slot. The connection is invalid after.
+    bool disconnect(Connection& connection)
+    {
+        if(!connection) return false;
+        Index id = connection.id_;
+        Index position = positions_[id];
+        if(generations_[id] != connection.generation_ || position >= count_ || ids_[position] != id) return false;
+        remove(position);
+        connection = Connection{};
+        return true;
+    }
+
+    // Disconnect a slot equal to this one (the same function or the same object and method), if any
+    bool disconnect(const Slot& slot)
+    {
+        Index position = find(slot);
+        if(position >= count_) return false;
+        remove(position);
+        return true;
+    }
+
+    // Disconnect a slot calling this member function of this object, if any
+    template<typename O, typename M>
+    bool disconnect(O& object, M method) { return disconnect(Slot{object, method}); }
+
+    // Is a slot equal to this one connected?
+    bool connected(const Slot& slot) const { return find(slot) < count_; }
+
+    // Disconnect all the slots
+    void clear()
+    {
+        if(emission_ != nullptr)
+        {
+            for(Index i = 0; i < count_; ++i) if(alive(i)) remove(i);
+            return;
+        }
+        while(count_ > 0)
+        {
+            ++generations_[ids_[--count_]];
+            slots_[count_] = nullptr;
+        }
+        fill(index_, index_ + BUCKETS, static_cast<Index>(N));
+    }
+
+    // Call all the connected slots
+    void emit(A... args)
+    {
+        Emission emission{emission_};
+        emission_ = &emission;
+        Index& i = emission.running_;
+        if(emission.outer_ == nullptr)
+            for(i = 0; i < count_; ++i) slots_[i](static_cast<A>(args)...);
+        else // The slots running in the outer emissions may be disconnected but not empty
+            for(i = 0; i < count_; ++i) if(alive(i)) slots_[i](static_cast<A>(args)...);
+        end_emit(emission);
+    }
+
+    void operator()(A... args) { emit(static_cast<A>(args)...); }
+
+    // Call all the connected slots and combine their results. Empty slots are not combined.
+    template<typename Combiner>
+    Combiner collect(Combiner combiner, A... args)
+    {
+        Emission emission{emission_};
+        emission_ = &emission;
+        Index& i = emission.running_;
+        if(emission.outer_ == nullptr)
+            for(i = 0; i < count_; ++i) { if(slots_[i]) combiner(slots_[i](static_cast<A>(args)...)); }
+        else
+            for(i = 0; i < count_; ++i) if(alive(i) && slots_[i]) combiner(slots_[i](static_cast<A>(args)...));
+        end_emit(emission);
+        return combiner;
+    }
+
+    size_t size() const noexcept { return count_ - dead_; }
+    bool empty() const noexcept { return size() == 0; }
+    bool full() const noexcept { return count_ >= N; }
+    static constexpr size_t capacity() noexcept { return N; }
+
+private:
+    static constexpr size_t buckets(size_t n) { size_t b = 1; while(b < 2 * n) b *= 2; return b; }
+    static constexpr size_t BUCKETS = buckets(N); // At most half full
+    static constexpr size_t MASK = BUCKETS - 1;
+
+    static size_t home(const Slot& slot) { return slot.hash() & MASK; }
+
+    // An emit (or collect) in progress, nested if a slot emits again
+    struct Emission
+    {
+        explicit Emission(Emission* outer): outer_{outer} {}
+        Emission* outer_;
+        Index running_ = 0; // Position of the slot called
+    };
+
+    // Position of a slot equal to this one, N if there is none
+    Index find(const Slot& slot) const
+    {
+        for(size_t i = home(slot); index_[i] < N; i = (i + 1) & MASK)
+            if(slots_[index_[i]] == slot) return index_[i];
+        return static_cast<Index>(N);
+    }
+
+    // Bucket referencing the slot at this position
+    size_t bucket_of(Index position) const
+    {
+        size_t i = home(slots_[position]);
+        while(index_[i] != position) i = (i + 1) & MASK;
+        return i;
+    }
+
+    void add_to_index(Index position)
+    {
+        size_t i = home(slots_[position]);
+        while(index_[i] < N) i = (i + 1) & MASK;
+        index_[i] = position;
+    }
+
+    // Remove the bucket of the slot at this position and shift back the following ones
+    void remove_from_index(Index position)
+    {
+        size_t hole = bucket_of(position);
+        for(size_t i = (hole + 1) & MASK; index_[i] < N; i = (i + 1) & MASK)
+        {
+            // Move the entry into the hole unless its home is between the hole and itself
+            size_t h = home(slots_[index_[i]]);
+            if(((i - h) & MASK) >= ((i - hole) & MASK)) { index_[hole] = index_[i]; hole = i; }
+        }
+        index_[hole] = static_cast<Index>(N);
+    }
+
+    // Is the slot at this position still connected? Slots disconnected during emit are not.
+    bool alive(Index position) const { return positions_[ids_[position]] == position; }
+
+    // Is the slot at this position called by an emission in progress?
+    bool running(Index position) const
+    {
+        for(const Emission* emission = emission_; emission != nullptr; emission = emission->outer_)
+            if(emission->running_ == position) return true;
+        return false;
+    }
+
+    // Disconnect the slot at this position. During emit, the slot is marked and
+    // removed after. It is emptied now, unless it is running.
+    void remove(Index position)
+    {
+        remove_from_index(position);
+        Index id = ids_[position];
+        ++generations_[id]; // Invalidate the connections of this slot
+        if(emission_ == nullptr) { compact(position); return; }
+        positions_[id] = static_cast<Index>(N);
+        ++dead_;
+        if(!running(position)) slots_[position] = nullptr;
+    }
+
+    void end_emit(const Emission& emission)
+    {
+        emission_ = emission.outer_;
+        if(emission_ != nullptr || dead_ == 0) return;
+        // From the end, so the last slot is always a connected one
+        for(Index position = count_; position-- > 0;)
+        {
+            if(alive(position)) continue;
+            positions_[ids_[position]] = position;
+            compact(position);
+        }
+        dead_ = 0;
+    }
+
+    // Remove the slot at this position (already removed from the index): the last slot takes its place
+    void compact(Index position)
+    {
+        Index last = static_cast<Index>(--count_);
+        if(position != last)
+        {
+            index_[bucket_of(last)] = position;
+            Index id = ids_[position];
+            slots_[position] = move(slots_[last]);
+            ids_[position] = ids_[last];
+            positions_[ids_[position]] = position;
+            ids_[last] = id;
+            positions_[id] = last;
+        }
+        slots_[last] = nullptr;
+    }
+
+private:
+    Slot slots_[N];
+    Index ids_[N];        // Identifier of the slot at each position, then free identifiers
+    Index positions_[N];  // Position of the slot of each identifier
+    Index index_[BUCKETS]; // Positions of the slots by hash, N for empty buckets
+    unsigned char generations_[N] = {}; // Incremented when the slot of each identifier is disconnected
+    Index count_ = 0;
+    Index dead_ = 0;       // Slots disconnected during emit, not removed yet
+    Emission* emission_ = nullptr; // Innermost emit in progress
+};
+
+template<typename R, typename... A, size_t N, typename Slot>
+constexpr size_t Signal<R(*)(A...), N, Slot>::BUCKETS;
+
+}
+
+#endif //ADVLIB_ADVSIGNAL_H
@@ -0,0 +1,163 @@
+/**
+ * ADVspsc_queue - Lock-free single-producer / single-consumer queues
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVSPSC_QUEUE_H
+#define ADVLIB_ADVSPSC_QUEUE_H
+
+#include "ADVstd.h"
+#include "ADVcallback.h"
+
+// Freestanding targets use the compiler builtins, hosted ones use <atomic>
+#if defined(__AVR__) || (defined(__STDC_HOSTED__) && __STDC_HOSTED__ == 0) || defined(ADV_NO_STD_ATOMIC)
+#define ADV_BUILTIN_ATOMIC 1
+#else
+#include <atomic>
+#endif
+
+namespace adv
+{
+
+namespace internal
+{
+#ifdef ADV_BUILTIN_ATOMIC
+    template<typename T>
+    struct AtomicIndex
+    {
+        T load_relaxed() const { return __atomic_load_n(&value_, __ATOMIC_RELAXED); }
+        T load_acquire() const { return __atomic_load_n(&value_, __ATOMIC_ACQUIRE); }
+        void store_release(T value) { __atomic_store_n(&value_, value, __ATOMIC_RELEASE); }
+    private:
+        T value_ = 0;
+    };
+
+    static const size_t CACHE_LINE = alignof(size_t);
+#else
+    template<typename T>
+    struct AtomicIndex
+    {
+        T load_relaxed() const { return value_.load(std::memory_order_relaxed); }
+        T load_acquire() const { return value_.load(std::memory_order_acquire); }
+        void store_release(T value) { value_.store(value, std::memory_order_release); }
+    private:
+        std::atomic<T> value_{0};
+    };
+
+    // Keep the indices of the producer and of the consumer on different cache lines
+    static const size_t CACHE_LINE = 64;
+#endif
+}
+
+// --------------------------------------------------------------------
+// A lock-free FIFO of up to N tasks (N is a power of two) between exactly
+// one producer (for example an interrupt handler) and one consumer (for
+// example the main loop). Indices are published with release stores and
+// read with acquire loads, so a task is always completely written before
+// the consumer sees it. A Batch publishes several tasks with one store.
+// --------------------------------------------------------------------
+
+template<size_t N, typename T = Callback<void(*)()>>
+struct SpscQueue
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "Capacity has to be a power of two");
+
+    // Free-running indices: they wrap at a multiple of N
+    using Index = typename uint_for<N>::type;
+
+    // Several tasks pushed by the producer and published at once by commit (or the destructor)
+    struct Batch
+    {
+        explicit Batch(SpscQueue& queue):
+            queue_{queue}, tail_{queue.tail_.load_relaxed()}, head_{queue.head_.load_acquire()} {}
+        ~Batch() { commit(); }
+
+        bool push(const T& task)
+        {
+            // The head is only reloaded when the queue looks full
+            if(static_cast<Index>(tail_ - head_) >= N && static_cast<Index>(tail_ - (head_ = queue_.head_.load_acquire())) >= N)
+                return false;
+            queue_.tasks_[tail_ & MASK] = task;
+            ++tail_;
+            return true;
+        }
+
+        void commit() { queue_.tail_.store_release(tail_); }
+
+        Batch(const Batch&) = delete;
+        Batch& operator=(const Batch&) = delete;
+
+    private:
+        SpscQueue& queue_;
+        Index tail_;
+        Index head_;
+    };
+
+    // Producer: add a task. Return false if the queue is full.
+    bool push(const T& task)
+    {
+        Index tail = tail_.load_relaxed();
+        if(static_cast<Index>(tail - head_.load_acquire()) >= N) return false;
+        tasks_[tail & MASK] = task;
+        tail_.store_release(static_cast<Index>(tail + 1));
+        return true;
+    }
+
+    // Consumer: remove the next task. Return false if the queue is empty.
+    bool pop(T& task)
+    {
+        Index head = head_.load_relaxed();
+        if(head == tail_.load_acquire()) return false;
+        task = move(tasks_[head & MASK]);
+        tasks_[head & MASK] = nullptr;
+        head_.store_release(static_cast<Index>(head + 1));
+        return true;
+    }
+
+    // Consumer: run up to max_tasks tasks, releasing their slots with one store.
+    size_t run_pending(size_t max_tasks = N)
+    {
+        Index head = head_.load_relaxed();
+        Index available = static_cast<Index>(tail_.load_acquire() - head);
+        size_t count = available < max_tasks ? available : max_tasks;
+        for(size_t i = 0; i < count; ++i)
+        {
+            T task{move(tasks_[(head + i) & MASK])};
+            tasks_[(head + i) & MASK] = nullptr;
+            task();
+        }
+        head_.store_release(static_cast<Index>(head + count));
+        return count;
+    }
+
+    // Approximate when the other side is running
+    size_t size() const { return static_cast<Index>(tail_.load_acquire() - head_.load_acquire()); }
+    bool empty() const { return size() == 0; }
+    static constexpr size_t capacity() noexcept { return N; }
+
+private:
+    static const size_t MASK = N - 1;
+
+    T tasks_[N];
+    alignas(internal::CACHE_LINE) internal::AtomicIndex<Index> head_; // Written by the consumer
+    alignas(internal::CACHE_LINE) internal::AtomicIndex<Index> tail_; // Written by the producer
+};
+
+}
+
+#endif //ADVLIB_ADVSPSC_QUEUE_H
@@ -28,10 +28,19 @@ namespace adv {
 using size_t = decltype(sizeof(int));
 using nullptr_t = decltype(nullptr);
 
+// A type with the strictest alignment of scalar types
+union max_align_t { long long ll; long double ld; void* p; void (*f)(); };
+
 template<typename T> struct remove_reference { using type = T; };
 template<typename T> struct remove_reference<T&>  { using type = T; };
 template<typename T> struct remove_reference<T&&> { using type = T; };
 
+template<typename T> struct remove_const { using type = T; };
+template<typename T> struct remove_const<const T> { using type = T; };
+template<typename T> struct remove_volatile { using type = T; };
+template<typename T> struct remove_volatile<volatile T> { using type = T; };
+template<typename T> struct remove_cv { using type = typename remove_volatile<typename remove_const<T>::type>::type; };
+
 template<typename T, T v>
 struct integral_constant
 {
@@ -57,6 +66,22 @@ template<> struct is_void<void> { static const bool value = true; };
 
 template<typename...> using void_t = void;
 
+template<typename T>
+struct is_trivially_copyable: bool_constant<__is_trivially_copyable(T)> {};
+
+// __has_trivial_destructor is deprecated by recent versions of Clang
+#if defined(__has_builtin)
+#if __has_builtin(__is_trivially_destructible)
+#define ADV_IS_TRIVIALLY_DESTRUCTIBLE(T) __is_trivially_destructible(T)
+#endif
+#endif
+#ifndef ADV_IS_TRIVIALLY_DESTRUCTIBLE
+#define ADV_IS_TRIVIALLY_DESTRUCTIBLE(T) __has_trivial_destructor(T)
+#endif
+
+template<typename T>
+struct is_trivially_destructible: bool_constant<ADV_IS_TRIVIALLY_DESTRUCTIBLE(T)> {};
+
 template<class T, class U>
 struct is_same : false_type {};
 
@@ -97,7 +122,43 @@ template<typename T>           struct add_pointer: ap_<T, void> {};
 
 template<typename T> void swap(T& a, T& b) { T c{move(a)}; a = move(b); b = move(c); }
 
-template<typename T> auto declval() noexcept -> add_rvalue_reference_t<T>;
+template<typename T> auto declval() noexcept -> typename add_rvalue_reference_t<T>::type;
+
+template<typename T> void convert_to_(T) noexcept;
+template<typename From, typename To, typename = void> struct ic_: false_type {};
+template<typename From, typename To> struct ic_<From, To, void_t<decltype(convert_to_<To>(declval<From>()))>>: true_type {};
+
+template<typename From, typename To> struct is_convertible: ic_<From, To> {};
+
+template<bool B, typename T, typename F> struct conditional { using type = T; };
+template<typename T, typename F> struct conditional<false, T, F> { using type = F; };
+
+// Smallest unsigned type able to hold values up to N
+template<size_t N>
+struct uint_for
+{
+    using type = typename conditional<N <= 0xFF, unsigned char,
+                 typename conditional<N <= 0xFFFF, unsigned short, size_t>::type>::type;
+};
+
+template<typename T> struct is_pointer_: false_type {};
+template<typename T> struct is_pointer_<T*>: true_type {};
+template<typename T> struct is_pointer: is_pointer_<typename remove_cv<T>::type> {};
+
+template<typename T> struct is_empty: bool_constant<__is_empty(T)> {};
+template<typename T> struct is_final: bool_constant<__is_final(T)> {};
+
+// Type of a parameter passed by value: without reference and cv-qualifiers, arrays and functions become pointers
+template<typename T> struct decay_ { using type = typename remove_cv<T>::type; };
+template<typename T> struct decay_<T[]> { using type = T*; };
+template<typename T, size_t N> struct decay_<T[N]> { using type = T*; };
+template<typename R, typename... A> struct decay_<R(A...)> { using type = R(*)(A...); };
+template<typename T> struct decay: decay_<typename remove_reference<T>::type> {};
+
+template<size_t... I> struct index_sequence {};
+template<size_t N, size_t... I> struct mis_: mis_<N - 1, N - 1, I...> {};
+template<size_t... I> struct mis_<0, I...> { using type = index_sequence<I...>; };
+template<size_t N> using make_index_sequence = typename mis_<N>::type;
 
 template<bool, typename T = void> struct enable_if {};
 template<typename T> struct enable_if<true, T> { using type = T; };
@@ -111,6 +172,41 @@ inline O copy(I first, I last, O d_first)
     return d_first;
 }
 
+template<typename O, typename T>
+inline void fill(O first, O last, const T& value)
+{
+    while(first != last)
+        *first++ = value;
+}
+
+template<typename I1, typename I2>
+inline bool equal(I1 first1, I1 last1, I2 first2)
+{
+    for(; first1 != last1; ++first1, ++first2)
+        if(!(*first1 == *first2)) return false;
+    return true;
+}
+
+namespace internal
+{
+    // Hash of a block of memory (FNV-1a, one word at a time). The high bits are folded
+    // into the low ones since hash tables use the low bits.
+    inline size_t hash_bytes(const void* data, size_t size, size_t hash = 2166136261u)
+    {
+        const size_t prime = sizeof(size_t) > 4 ? static_cast<size_t>(1099511628211ULL) : 16777619u;
+        auto bytes = static_cast<const unsigned char*>(data);
+        size_t i = 0;
+        for(; i + sizeof(size_t) <= size; i += sizeof(size_t))
+        {
+            size_t word = 0;
+            copy(bytes + i, bytes + i + sizeof(size_t), reinterpret_cast<unsigned char*>(&word));
+            hash = (hash ^ word) * prime;
+        }
+        for(; i < size; ++i) hash = (hash ^ bytes[i]) * prime;
+        return hash ^ (hash >> (sizeof(size_t) * 4));
+    }
+}
+
 } // namespace adv
 
 #endif
@@ -0,0 +1,131 @@
+/**
+ * ADVtask_queue - Queues of deferred tasks
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVTASK_QUEUE_H
+#define ADVLIB_ADVTASK_QUEUE_H
+
+#include "ADVstd.h"
+#include "ADVcallback.h"
+
+namespace adv
+{
+
+// --------------------------------------------------------------------
+// A FIFO of up to N tasks (N is a power of two), stored in a ring buffer.
+// Tasks are posted by producers and executed by run_pending, typically
+// once per iteration of the main loop. This is not interrupt-safe.
+// --------------------------------------------------------------------
+
+template<size_t N, typename T = Callback<void(*)()>>
+struct TaskQueue
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "Capacity has to be a power of two");
+
+    using Task = T;
+
+    // Add a task at the end of the queue. Return false (and drop the task) if the queue is full.
+    bool post(const T& task)
+    {
+        if(!accept()) return false;
+        tasks_[(head_ + count_++) & MASK] = task;
+        update_high_water();
+        return true;
+    }
+
+    // Add a task at the front of the queue, it will be the next to run.
+    bool post_front(const T& task)
+    {
+        if(!accept()) return false;
+        head_ = (head_ - 1) & MASK;
+        tasks_[head_] = task;
+        ++count_;
+        update_high_water();
+        return true;
+    }
+
+    // Run up to max_tasks tasks, and no more than the number of tasks queued on entry.
+    // Tasks posted with post while running are not run before the next call. Tasks posted
+    // with post_front are run next, in place of the last tasks queued which then wait.
+    // A task can clear the queue, the remaining tasks are then not run.
+    size_t run_pending(size_t max_tasks = N)
+    {
+        size_t pending = count_ < max_tasks ? count_ : max_tasks;
+        size_t ran = 0;
+        while(ran < pending && run_next()) ++ran;
+        return ran;
+    }
+
+    // Run tasks while clock() - start < budget. At least one task is run, if any.
+    // The tasks are counted as in run_pending.
+    // clock is any callable returning an unsigned tick count (such as millis).
+    template<typename Clock, typename Ticks>
+    size_t run_pending_for(Clock clock, Ticks budget)
+    {
+        size_t pending = count_;
+        if(pending == 0) return 0;
+        const Ticks start = clock();
+        size_t ran = 0;
+        while(run_next() && ++ran < pending && static_cast<Ticks>(clock() - start) < budget) {}
+        return ran;
+    }
+
+    void clear() { while(count_ > 0) { tasks_[head_] = nullptr; head_ = (head_ + 1) & MASK; --count_; } }
+
+    size_t size() const noexcept { return count_; }
+    bool empty() const noexcept { return count_ == 0; }
+    bool full() const noexcept { return count_ >= N; }
+    static constexpr size_t capacity() noexcept { return N; }
+
+    // Maximum number of tasks queued at the same time
+    size_t high_water() const noexcept { return high_water_; }
+    // Number of tasks dropped because the queue was full
+    size_t dropped() const noexcept { return dropped_; }
+    void reset_statistics() noexcept { high_water_ = count_; dropped_ = 0; }
+
+private:
+    static const size_t MASK = N - 1;
+
+    bool accept() { if(count_ < N) return true; ++dropped_; return false; }
+    void update_high_water() { if(count_ > high_water_) high_water_ = count_; }
+
+    // The task is removed from the queue before being run, so it can post other tasks.
+    // Return false if the queue is empty.
+    bool run_next()
+    {
+        if(count_ == 0) return false;
+        T task{move(tasks_[head_])};
+        tasks_[head_] = nullptr;
+        head_ = (head_ + 1) & MASK;
+        --count_;
+        task();
+        return true;
+    }
+
+private:
+    T tasks_[N];
+    size_t head_ = 0;
+    size_t count_ = 0;
+    size_t high_water_ = 0;
+    size_t dropped_ = 0;
+};
+
+}
+
+#endif //ADVLIB_ADVTASK_QUEUE_H
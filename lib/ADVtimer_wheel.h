@@ -0,0 +1,198 @@
+/**
+ * ADVtimer_wheel - Timers scheduling Callbacks at deadlines
+ *
+ * Copyright (C) 2018 Sebastien Andrivet [https://github.com/andrivet/]
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ADVLIB_ADVTIMER_WHEEL_H
+#define ADVLIB_ADVTIMER_WHEEL_H
+
+#include "ADVstd.h"
+#include "ADVcallback.h"
+
+namespace adv
+{
+
+// --------------------------------------------------------------------
+// A hashed timer wheel of up to Capacity timers and Slots buckets (a power
+// of two). A timer is stored in the bucket of its deadline, so schedule and
+// cancel are O(1). advance(now) only visits the buckets of the elapsed
+// ticks, and fires their expired timers. Timers more than Slots ticks
+// away stay in their bucket until their deadline. Nodes are preallocated.
+// Ticks is an unsigned type and is allowed to wrap (as millis does).
+// --------------------------------------------------------------------
+
+template<size_t Capacity, size_t Slots = 256, typename T = Callback<void(*)()>, typename Ticks = unsigned long>
+struct TimerWheel
+{
+    static_assert(Slots > 0 && (Slots & (Slots - 1)) == 0, "Number of slots has to be a power of two");
+
+    using Index = typename uint_for<Capacity>::type;
+
+    // Handle of a scheduled timer
+    struct Timer
+    {
+        Timer() = default;
+        explicit operator bool() const noexcept { return index_ != NONE; }
+    private:
+        friend TimerWheel;
+        Timer(Index index, unsigned char generation): index_{index}, generation_{generation} {}
+        Index index_ = NONE;
+        unsigned char generation_ = 0;
+    };
+
+    explicit TimerWheel(Ticks now = 0) noexcept: now_{now}
+    {
+        for(size_t i = 0; i < Slots; ++i) buckets_[i] = NONE;
+        for(size_t i = 0; i < Capacity; ++i) nodes_[i].next_ = static_cast<Index>(i + 1 < Capacity ? i + 1 : NONE);
+    }
+
+    // Schedule a task delay ticks after the current time (at least one tick).
+    // Return an invalid timer if all the nodes are in use.
+    Timer schedule(Ticks delay, const T& task)
+    {
+        if(free_ == NONE) return Timer{};
+        Index index = free_;
+        Node& node = nodes_[index];
+        free_ = node.next_;
+
+        node.task_ = task;
+        node.deadline_ = static_cast<Ticks>(now_ + (delay > 0 ? delay : 1));
+        node.state_ = State::Scheduled;
+        link(index);
+        ++size_;
+        return Timer{index, node.generation_};
+    }
+
+    // Cancel a timer. Return false if it has already fired or was already cancelled.
+    bool cancel(Timer& timer)
+    {
+        if(!timer) return false;
+        Index index = timer.index_;
+        unsigned char generation = timer.generation_;
+        timer = Timer{};
+        Node& node = nodes_[index];
+        if(node.generation_ != generation || node.state_ == State::Free) return false;
+
+        if(node.state_ == State::Scheduled) { unlink(index); release(index); }
+        else node.task_ = nullptr; // Expiring: it will not be called
+        return true;
+    }
+
+    // Move the current time to now and fire all the expired timers. Return the number of timers fired.
+    size_t advance(Ticks now)
+    {
+        Ticks elapsed = static_cast<Ticks>(now - now_);
+        size_t steps = elapsed < Slots ? static_cast<size_t>(elapsed) : Slots;
+
+        // First, collect the expired timers so tasks can schedule or cancel timers safely
+        Index expired = NONE;
+        for(size_t step = 1; step <= steps; ++step)
+        {
+            size_t bucket = (now_ + step) & MASK;
+            for(Index index = buckets_[bucket]; index != NONE;)
+            {
+                Node& node = nodes_[index];
+                Index next = node.next_;
+                if(static_cast<Ticks>(now - node.deadline_) <= HALF_RANGE)
+                {
+                    unlink(index);
+                    node.state_ = State::Expiring;
+                    node.next_ = expired;
+                    expired = index;
+                }
+                index = next;
+            }
+        }
+        now_ = now;
+
+        // Then fire them
+        size_t fired = 0;
+        while(expired != NONE)
+        {
+            Index index = expired;
+            Node& node = nodes_[index];
+            expired = node.next_;
+            T task{move(node.task_)};
+            release(index);
+            if(task) { task(); ++fired; }
+        }
+        return fired;
+    }
+
+    Ticks now() const noexcept { return now_; }
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    static constexpr size_t capacity() noexcept { return Capacity; }
+
+private:
+    static const Index NONE = static_cast<Index>(Capacity);
+    static const size_t MASK = Slots - 1;
+    static const Ticks HALF_RANGE = static_cast<Ticks>(~Ticks(0)) / 2;
+
+    enum class State: unsigned char { Free, Scheduled, Expiring };
+
+    struct Node
+    {
+        T task_;
+        Ticks deadline_ = 0;
+        Index next_ = NONE;
+        Index previous_ = NONE;
+        unsigned char generation_ = 0;
+        State state_ = State::Free;
+    };
+
+    void link(Index index)
+    {
+        Node& node = nodes_[index];
+        Index& head = buckets_[node.deadline_ & MASK];
+        node.previous_ = NONE;
+        node.next_ = head;
+        if(head != NONE) nodes_[head].previous_ = index;
+        head = index;
+    }
+
+    void unlink(Index index)
+    {
+        Node& node = nodes_[index];
+        if(node.previous_ != NONE) nodes_[node.previous_].next_ = node.next_;
+        else buckets_[node.deadline_ & MASK] = node.next_;
+        if(node.next_ != NONE) nodes_[node.next_].previous_ = node.previous_;
+    }
+
+    void release(Index index)
+    {
+        Node& node = nodes_[index];
+        node.task_ = nullptr;
+        node.state_ = State::Free;
+        ++node.generation_; // Invalidate the handles of this node
+        node.next_ = free_;
+        free_ = index;
+        --size_;
+    }
+
+private:
+    Node nodes_[Capacity];
+    Index buckets_[Slots];
+    Index free_ = 0;
+    size_t size_ = 0;
+    Ticks now_;
+};
+
+}
+
+#endif //ADVLIB_ADVTIMER_WHEEL_H
@@ -0,0 +1,107 @@
+#include "ADVbatch.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+namespace
+{
+    int total = 0;
+    void accumulate(int sample) { total += sample; }
+
+    struct Average
+    {
+        void add(int sample) { sum_ += sample; ++count_; }
+        int sum_ = 0;
+        int count_ = 0;
+    };
+}
+
+SCENARIO("A span gives access to a batch of items", "[batch]")
+{
+    GIVEN("A span of an array")
+    {
+        int samples[] = {1, 2, 3, 4, 5};
+        Span<int> span{samples};
+        THEN("It contains all the items")
+        {
+            CHECK(span.size() == 5);
+            CHECK(span.data() == samples);
+            CHECK(span[4] == 5);
+            CHECK(!span.empty());
+        }
+        WHEN("A part of it is taken")
+        {
+            auto part = span.subspan(3, 10);
+            THEN("It is limited to the end of the span")
+            {
+                CHECK(part.size() == 2);
+                CHECK(part[0] == 4);
+            }
+        }
+    }
+    GIVEN("An empty span")
+    {
+        Span<const int> span;
+        THEN("It is empty") CHECK(span.empty());
+    }
+}
+
+SCENARIO("Scalar callables are lifted to batch callbacks", "[batch]")
+{
+    total = 0;
+    const int samples[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    GIVEN("A batch callback lifting a function")
+    {
+        BatchCallback<const int> callback{for_each(&accumulate)};
+        WHEN("It is called with a batch")
+        {
+            callback(Span<const int>{samples});
+            THEN("The function is called for each item") CHECK(total == 55);
+        }
+    }
+    GIVEN("A batch callback lifting a lambda with a state")
+    {
+        int count = 0;
+        BatchCallback<const int> callback{for_each([&count](int) { ++count; })};
+        WHEN("It is called with an empty batch")
+        {
+            callback(Span<const int>{});
+            THEN("Nothing is called") CHECK(count == 0);
+        }
+        WHEN("The items are sent by batches of 4")
+        {
+            int calls = 0;
+            auto counting = [&](Span<const int> items) { ++calls; callback(move(items)); };
+            dispatch_by(4, Span<const int>{samples}, counting);
+            THEN("The batches are smaller than 4 and cover all the items")
+            {
+                CHECK(calls == 3);
+                CHECK(count == 10);
+            }
+        }
+    }
+    GIVEN("A batch callback lifting a method bound to an object")
+    {
+        Average average;
+        BatchCallback<const int> callback{for_each(bind_front(&Average::add, &average))};
+        WHEN("It is called with a batch")
+        {
+            callback(Span<const int>{samples});
+            THEN("The method is called for each item")
+            {
+                CHECK(average.sum_ == 55);
+                CHECK(average.count_ == 10);
+            }
+        }
+    }
+    GIVEN("A batch callback changing the items")
+    {
+        int values[] = {1, 2, 3};
+        BatchCallback<int> callback{for_each([](int& value) { value *= 2; })};
+        WHEN("It is called")
+        {
+            callback(Span<int>{values});
+            THEN("The items are changed") CHECK((values[0] == 2 && values[1] == 4 && values[2] == 6));
+        }
+    }
+}
@@ -0,0 +1,103 @@
+#include "ADVbind.h"
+#include "ADVcallback.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+namespace
+{
+    struct Heater
+    {
+        int set(int index, int offset, int value) { return temperatures_[index] = value + offset; }
+        int get(int index) const { return temperatures_[index]; }
+        int temperatures_[2] = {};
+    };
+
+    int add(int a, int b) { return a + b; }
+
+    struct Empty { int operator()(int a, int b) const { return a * b; } };
+
+    struct Counted
+    {
+        Counted() = default;
+        Counted(const Counted&) { ++copies; }
+        Counted(Counted&&) noexcept { ++moves; }
+        static int copies;
+        static int moves;
+    };
+
+    int Counted::copies = 0;
+    int Counted::moves = 0;
+
+    int use(const Counted&, int i) { return i; }
+}
+
+static_assert(sizeof(BindFront<Empty, int>) == sizeof(int), "An empty callable takes no space");
+
+SCENARIO("Leading arguments can be bound", "[bind]")
+{
+    GIVEN("A function with its first argument bound")
+    {
+        auto f = bind_front(add, 40);
+        THEN("It can be called with the other argument") CHECK(f(2) == 42);
+    }
+    GIVEN("A functor with its first argument bound")
+    {
+        auto f = bind_front(Empty{}, 6);
+        THEN("It can be called with the other argument") CHECK(f(7) == 42);
+    }
+    GIVEN("A member function with an object and its first arguments bound")
+    {
+        Heater heater;
+        auto f = bind_front(&Heater::set, &heater, 1, 2);
+        THEN("It can be called with the other argument")
+        {
+            CHECK(f(40) == 42);
+            CHECK(heater.temperatures_[1] == 42);
+        }
+    }
+    GIVEN("A const member function with a const object bound")
+    {
+        const Heater heater;
+        const auto f = bind_front(&Heater::get, &heater);
+        THEN("It can be called") CHECK(f(0) == 0);
+    }
+    GIVEN("A bound argument")
+    {
+        Counted counted;
+        auto f = bind_front(use, counted);
+        Counted::copies = 0;
+        Counted::moves = 0;
+        THEN("It is not copied when called")
+        {
+            CHECK(f(1) == 1);
+            CHECK(Counted::copies == 0);
+            CHECK(Counted::moves == 0);
+        }
+    }
+}
+
+SCENARIO("Callbacks can be constructed with bound arguments", "[bind]")
+{
+    GIVEN("A callback from an object, a member function and bound arguments")
+    {
+        Heater heater;
+        Callback<int(*)(int)> cb{heater, &Heater::set, 0, 1};
+        THEN("It can be called with the other argument")
+        {
+            CHECK(cb(41) == 42);
+            CHECK(heater.temperatures_[0] == 42);
+        }
+    }
+    GIVEN("A callback from an object pointer, a member function and bound arguments")
+    {
+        Heater heater;
+        Callback<int(*)(int)> cb{&heater, &Heater::set, 1, 2};
+        THEN("It can be called with the other argument") CHECK(cb(40) == 42);
+    }
+    GIVEN("A callback from bind_front")
+    {
+        Callback<int(*)(int)> cb{bind_front(add, 2)};
+        THEN("It can be called with the other argument") CHECK(cb(40) == 42);
+    }
+}
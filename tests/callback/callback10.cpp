@@ -0,0 +1,150 @@
+#include "ADVcallback.h"
+#include "ADVcompact_callback.h"
+#include "ADVdelegate.h"
+#include "ADVfunction_ref.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+namespace
+{
+    // A large argument counting its copies and moves
+    struct Big
+    {
+        Big() = default;
+        Big(const Big& other): value_{other.value_} { ++copies; }
+        Big(Big&& other) noexcept: value_{other.value_} { ++moves; }
+        Big& operator=(const Big&) = delete;
+
+        int value_ = 1;
+        int padding_[32] = {};
+
+        static int copies;
+        static int moves;
+        static void reset() { copies = moves = 0; }
+    };
+
+    int Big::copies = 0;
+    int Big::moves = 0;
+
+    int by_value(Big big) { return big.value_; }
+    int by_reference(const Big& big) { return big.value_; }
+    int by_rvalue(Big&& big) { Big taken{move(big)}; return taken.value_; }
+    void change(Big& big) { big.value_ = 42; }
+
+    struct Consumer
+    {
+        int take(Big big) { return big.value_; }
+        int look(const Big& big) const { return big.value_; }
+    };
+}
+
+SCENARIO("Arguments are forwarded to the target without extra copies", "[callback]")
+{
+    Big big;
+    Big::reset();
+
+    GIVEN("A callback taking a large argument by value")
+    {
+        const Callback<int(*)(Big)> cb{by_value};
+        WHEN("It is called with an lvalue")
+        {
+            CHECK(cb(big) == 1);
+            THEN("The argument is copied once, then moved") CHECK((Big::copies == 1 && Big::moves == 1));
+        }
+        WHEN("It is called with an rvalue")
+        {
+            CHECK(cb(Big{}) == 1);
+            THEN("The argument is only moved") CHECK((Big::copies == 0 && Big::moves == 1));
+        }
+    }
+    GIVEN("A callback taking a large argument by const reference")
+    {
+        Consumer consumer;
+        const Callback<int(*)(const Big&)> cb1{by_reference};
+        const Callback<int(*)(const Big&)> cb2{consumer, &Consumer::look};
+        const Callback<int(*)(const Big&)> cb3{[](const Big& b) { return b.value_; }};
+        WHEN("They are called with an lvalue")
+        {
+            CHECK(cb1(big) + cb2(big) + cb3(big) == 3);
+            THEN("The argument is neither copied nor moved") CHECK((Big::copies == 0 && Big::moves == 0));
+        }
+    }
+    GIVEN("A callback taking a method with an argument by value")
+    {
+        Consumer consumer;
+        Callback<int(*)(Big)> cb{consumer, &Consumer::take};
+        WHEN("It is called with an lvalue")
+        {
+            CHECK(cb(big) == 1);
+            THEN("The argument is copied once, then moved") CHECK((Big::copies == 1 && Big::moves == 1));
+        }
+    }
+    GIVEN("A callback taking a large argument by rvalue reference")
+    {
+        UniqueCallback<int(*)(Big&&)> cb{by_rvalue};
+        WHEN("It is called with an rvalue")
+        {
+            CHECK(cb(move(big)) == 1);
+            THEN("The argument is moved once, by the target") CHECK((Big::copies == 0 && Big::moves == 1));
+        }
+    }
+    GIVEN("A callback taking an argument by reference")
+    {
+        const Callback<void(*)(Big&)> cb{change};
+        WHEN("It is called")
+        {
+            cb(big);
+            THEN("The argument of the caller is changed") CHECK(big.value_ == 42);
+            THEN("It is neither copied nor moved") CHECK((Big::copies == 0 && Big::moves == 0));
+        }
+    }
+}
+
+SCENARIO("Other callable types forward their arguments without extra copies", "[callback]")
+{
+    Big big;
+    Big::reset();
+    Consumer consumer;
+
+    GIVEN("Compact callbacks, delegates and function references taking a large argument by const reference")
+    {
+        const auto compact = CompactCallback<int(*)(const Big&)>::bind<Consumer, &Consumer::look>(consumer);
+        const auto delegate = Delegate<int(*)(const Big&)>::bind<Consumer, &Consumer::look>(consumer);
+        const FunctionRef<int(*)(const Big&)> ref{by_reference};
+        WHEN("They are called with an lvalue")
+        {
+            CHECK(compact(big) + delegate(big) + ref(big) == 3);
+            THEN("The argument is neither copied nor moved") CHECK((Big::copies == 0 && Big::moves == 0));
+        }
+    }
+    GIVEN("Compact callbacks, delegates and function references taking a large argument by value")
+    {
+        const CompactCallback<int(*)(Big)> compact{by_value};
+        const Delegate<int(*)(Big)> delegate{by_value};
+        const FunctionRef<int(*)(Big)> ref{by_value};
+        WHEN("They are called with an lvalue")
+        {
+            CHECK(compact(big) + delegate(big) + ref(big) == 3);
+            THEN("The argument is copied once and moved once by each") CHECK((Big::copies == 3 && Big::moves == 3));
+        }
+    }
+}
+
+SCENARIO("Const callbacks can call stateful targets", "[callback]")
+{
+    GIVEN("Const callbacks with mutable lambdas")
+    {
+        const Callback<int(*)()> cb{[n = 0]() mutable { return ++n; }};
+        const CompactCallback<int(*)()> compact{[n = 0]() mutable { return ++n; }};
+        WHEN("They are called several times")
+        {
+            cb(); compact();
+            THEN("Their state is updated")
+            {
+                CHECK(cb() == 2);
+                CHECK(compact() == 2);
+            }
+        }
+    }
+}
@@ -10,7 +10,7 @@ namespace
 {
     struct Task
     {
-        void set_background_task(const BackgroundTask& task, unsigned int delta = 500) { background_task_ = task; }
+        void set_background_task(const BackgroundTask& task, unsigned int /*delta*/ = 500) { background_task_ = task; }
         void clear_background_task() { background_task_ = nullptr; }
         void execute_background_task() { background_task_(); }
         bool has_background_task() const { return bool(background_task_); }
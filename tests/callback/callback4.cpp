@@ -0,0 +1,75 @@
+#include "ADVcallback.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+using MyCallback = Callback<int(*)(int)>;
+
+namespace
+{
+    struct Counted
+    {
+        Counted() { ++constructed; }
+        Counted(const Counted&) { ++constructed; }
+        ~Counted() { ++destroyed; }
+        int operator()(int i) const { return i + 1; }
+
+        static int constructed;
+        static int destroyed;
+    };
+
+    int Counted::constructed = 0;
+    int Counted::destroyed = 0;
+
+    struct Num
+    {
+        int get(int i) const { return n_ + i; }
+        int n_ = 40;
+    };
+}
+
+SCENARIO("Callbacks copy and destroy their targets", "[callback]")
+{
+    Counted::constructed = 0;
+    Counted::destroyed = 0;
+
+    GIVEN("A callback constructed from a functor")
+    {
+        {
+            Counted counted;
+            MyCallback cb{counted};
+            CHECK(cb(1) == 2);
+
+            WHEN("It is copied")
+            {
+                MyCallback cb2{cb};
+                THEN("The functor is copied") CHECK(Counted::constructed == 3);
+                THEN("The copy can be called") CHECK(cb2(2) == 3);
+            }
+            WHEN("It is assigned null")
+            {
+                cb = nullptr;
+                THEN("The functor is destroyed") CHECK(Counted::destroyed == 1);
+            }
+        }
+        THEN("All the functors are destroyed") CHECK(Counted::constructed == Counted::destroyed);
+    }
+}
+
+SCENARIO("Callbacks can be constructed from const methods", "[callback]")
+{
+    GIVEN("A const object")
+    {
+        const Num num;
+        WHEN("A callback is constructed from a reference and a const method")
+        {
+            MyCallback cb{num, &Num::get};
+            THEN("It can be called") CHECK(cb(2) == 42);
+        }
+        WHEN("A callback is constructed from a pointer and a const method")
+        {
+            MyCallback cb{&num, &Num::get};
+            THEN("It can be called") CHECK(cb(1) == 41);
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#include "ADVcallback.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+namespace
+{
+    int s = 0;
+    void function1() { s = 42; }
+
+    struct alignas(16) Aligned { int value = 16; };
+}
+
+using SmallCallback = Callback<void(*)(), sizeof(void*)>;
+using LargeCallback = Callback<int(*)(), 64>;
+using AlignedCallback = Callback<int(*)(), 32, 16>;
+
+static_assert(callback_traits<Callback<void(*)()>>::storage_size == 32, "Default size has changed");
+static_assert(callback_traits<SmallCallback>::footprint == sizeof(SmallCallback), "Wrong footprint");
+static_assert(callback_traits<SmallCallback>::footprint < callback_traits<Callback<void(*)()>>::footprint,
+              "A small callback has to be smaller than the default one");
+static_assert(alignof(AlignedCallback) == 16, "Wrong alignment");
+static_assert(SmallCallback::fits<internal::Function<void>>(), "A function has to fit in a small callback");
+
+SCENARIO("The storage of callbacks can be configured", "[callback]")
+{
+    s = 0;
+    GIVEN("A callback with a storage of a pointer")
+    {
+        SmallCallback cb{function1};
+        THEN("It can hold a function")
+        {
+            cb();
+            CHECK(s == 42);
+        }
+    }
+    GIVEN("A callback with a large storage")
+    {
+        int a = 1, b = 2, c = 3, d = 4, e = 5;
+        LargeCallback cb{[a, b, c, d, e]{ return a + b + c + d + e; }};
+        THEN("It can hold a lambda with many captures")
+        {
+            CHECK(cb() == 15);
+        }
+        WHEN("It is copied")
+        {
+            LargeCallback cb2{cb};
+            THEN("The copy can be called") CHECK(cb2() == 15);
+        }
+    }
+    GIVEN("A callback with an aligned storage")
+    {
+        Aligned aligned;
+        AlignedCallback cb{[aligned]{ return reinterpret_cast<size_t>(&aligned) % 16 == 0 ? aligned.value : 0; }};
+        THEN("Its target is aligned")
+        {
+            CHECK(cb() == 16);
+        }
+    }
+}
@@ -0,0 +1,100 @@
+#include "ADVcallback.h"
+#include "ADVpool.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+namespace
+{
+    struct Large
+    {
+        Large() { ++constructed; }
+        Large(const Large&) { ++constructed; }
+        ~Large() { ++destroyed; }
+        int operator()(int i) const { return values_[0] + values_[7] + i; }
+
+        int values_[8] = {1, 0, 0, 0, 0, 0, 0, 2};
+        static int constructed;
+        static int destroyed;
+    };
+
+    int Large::constructed = 0;
+    int Large::destroyed = 0;
+
+    int add1(int i) { return i + 1; }
+
+    using Pool = FixedBlockPool<sizeof(Large), 2>;
+    using HeapCallback = Callback<int(*)(int), 16, CALLBACK_ALIGN, HeapOverflow>;
+    using PoolCallback = Callback<int(*)(int), 16, CALLBACK_ALIGN, PoolOverflow<Pool>>;
+}
+
+SCENARIO("Targets too large for a callback can be stored on the heap", "[callback]")
+{
+    Large::constructed = 0;
+    Large::destroyed = 0;
+    OverflowStats<HeapOverflow>::reset();
+
+    GIVEN("A callback with a heap overflow")
+    {
+        {
+            HeapCallback cb{Large{}};
+            THEN("A large target can be called") CHECK(cb(3) == 6);
+            THEN("The overflow is counted")
+            {
+                CHECK(OverflowStats<HeapOverflow>::count == 1);
+                CHECK(OverflowStats<HeapOverflow>::live == 1);
+                CHECK(OverflowStats<HeapOverflow>::largest == sizeof(Large));
+            }
+            WHEN("It is copied")
+            {
+                HeapCallback cb2{cb};
+                THEN("The copy can be called") CHECK(cb2(4) == 7);
+                THEN("The copy is also stored out of line") CHECK(OverflowStats<HeapOverflow>::live == 2);
+            }
+        }
+        THEN("All targets are destroyed")
+        {
+            CHECK(Large::constructed == Large::destroyed);
+            CHECK(OverflowStats<HeapOverflow>::live == 0);
+        }
+    }
+    GIVEN("A callback with a heap overflow and a small target")
+    {
+        HeapCallback cb{add1};
+        THEN("The target is stored inline")
+        {
+            CHECK(cb(1) == 2);
+            CHECK(OverflowStats<HeapOverflow>::count == 0);
+        }
+    }
+}
+
+SCENARIO("Targets too large for a callback can be stored in a pool", "[callback]")
+{
+    OverflowStats<PoolOverflow<Pool>>::reset();
+
+    GIVEN("Two callbacks with a pool overflow")
+    {
+        PoolCallback cb1{Large{}};
+        PoolCallback cb2{Large{}};
+        THEN("They use the pool") CHECK(Pool::used() == 2);
+        THEN("They can be called")
+        {
+            CHECK(cb1(1) == 4);
+            CHECK(cb2(2) == 5);
+        }
+        WHEN("The pool is exhausted")
+        {
+            PoolCallback cb3{Large{}};
+            THEN("The new callback is empty") CHECK_FALSE(cb3);
+            THEN("The failure is counted") CHECK(OverflowStats<PoolOverflow<Pool>>::failed == 1);
+        }
+        WHEN("A callback is released")
+        {
+            cb1 = nullptr;
+            PoolCallback cb3{Large{}};
+            THEN("Its block is reused") CHECK(cb3(0) == 3);
+        }
+    }
+    THEN("All the blocks are released") CHECK(Pool::used() == 0);
+}
@@ -0,0 +1,107 @@
+#include "ADVcallback.h"
+#include "ADVunique_ptr.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+using MyCallback = UniqueCallback<int(*)(int)>;
+
+namespace
+{
+    struct Counted
+    {
+        explicit Counted(int value): value_{value} { ++constructed; }
+        Counted(Counted&& c): value_{c.value_} { ++constructed; ++moved; }
+        ~Counted() { ++destroyed; }
+        Counted(const Counted&) = delete;
+
+        int operator()(int i) const { return value_ + i; }
+
+        int value_;
+        static int constructed;
+        static int destroyed;
+        static int moved;
+    };
+
+    int Counted::constructed = 0;
+    int Counted::destroyed = 0;
+    int Counted::moved = 0;
+
+    struct Large
+    {
+        int operator()(int i) const { return p_ ? *p_ + i : 0; }
+        unique_ptr<int> p_;
+        int padding_[8] = {};
+    };
+}
+
+SCENARIO("UniqueCallbacks can hold move-only targets", "[callback]")
+{
+    Counted::constructed = 0;
+    Counted::destroyed = 0;
+    Counted::moved = 0;
+
+    GIVEN("A UniqueCallback constructed from a lambda owning a unique_ptr")
+    {
+        unique_ptr<int> p{new int{40}};
+        MyCallback cb{[p = move(p)](int i){ return *p + i; }};
+        THEN("It can be called") CHECK(cb(2) == 42);
+
+        WHEN("It is moved")
+        {
+            MyCallback cb2{move(cb)};
+            THEN("The new callback can be called") CHECK(cb2(1) == 41);
+            THEN("The original callback is empty") CHECK_FALSE(cb);
+        }
+        WHEN("It is move-assigned")
+        {
+            MyCallback cb2;
+            cb2 = move(cb);
+            THEN("The new callback can be called") CHECK(cb2(1) == 41);
+            THEN("The original callback is empty") CHECK_FALSE(cb);
+        }
+    }
+    GIVEN("A UniqueCallback constructed from a move-only functor")
+    {
+        {
+            MyCallback cb{Counted{10}};
+            WHEN("It is moved")
+            {
+                MyCallback cb2{move(cb)};
+                THEN("The functor is moved, not copied") CHECK(Counted::moved == 2);
+                THEN("The new callback can be called") CHECK(cb2(1) == 11);
+            }
+        }
+        THEN("All the functors are destroyed") CHECK(Counted::constructed == Counted::destroyed);
+    }
+    GIVEN("A UniqueCallback with a move-only target stored on the heap")
+    {
+        using HeapCallback = UniqueCallback<int(*)(int), 16, CALLBACK_ALIGN, HeapOverflow>;
+        Large large;
+        large.p_.reset(new int{5});
+        HeapCallback cb{move(large)};
+        THEN("It can be called") CHECK(cb(1) == 6);
+        WHEN("It is moved")
+        {
+            auto live = OverflowStats<HeapOverflow>::live;
+            HeapCallback cb2{move(cb)};
+            THEN("The target is not reallocated") CHECK(OverflowStats<HeapOverflow>::live == live);
+            THEN("The new callback can be called") CHECK(cb2(2) == 7);
+        }
+    }
+}
+
+SCENARIO("Callbacks can be moved", "[callback]")
+{
+    GIVEN("A callback with a captured value")
+    {
+        int a = 40;
+        Callback<int(*)(int)> cb{[a](int i){ return a + i; }};
+        WHEN("It is moved")
+        {
+            Callback<int(*)(int)> cb2{move(cb)};
+            THEN("The new callback can be called") CHECK(cb2(2) == 42);
+            THEN("The original callback is empty") CHECK_FALSE(cb);
+        }
+    }
+}
@@ -0,0 +1,133 @@
+#include "ADVcallback.h"
+#include "ADVcompact_callback.h"
+#include "ADVdelegate.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+using MyCallback = Callback<int(*)(int)>;
+
+namespace
+{
+    struct Num
+    {
+        int add(int i) { return n_ += i; }
+        int sub(int i) { return n_ -= i; }
+        int get(int i) const { return n_ + i; }
+        int n_ = 0;
+    };
+
+    int add1(int i) { return i + 1; }
+    int add2(int i) { return i + 2; }
+
+    struct NotTrivial
+    {
+        NotTrivial() = default;
+        NotTrivial(const NotTrivial&) {}
+        int operator()(int i) const { return i; }
+    };
+}
+
+SCENARIO("Callbacks with the same target are equal", "[callback]")
+{
+    Num n1, n2;
+    GIVEN("Callbacks bound to functions")
+    {
+        MyCallback cb1{add1}, cb2{add1}, cb3{add2};
+        THEN("Those with the same function are equal")
+        {
+            CHECK(cb1 == cb2);
+            CHECK(cb1.hash() == cb2.hash());
+            CHECK(cb1 != cb3);
+        }
+    }
+    GIVEN("Callbacks bound to methods")
+    {
+        MyCallback cb1{n1, &Num::add}, cb2{&n1, &Num::add}, cb3{n2, &Num::add}, cb4{n1, &Num::sub};
+        const Num& c1 = n1;
+        MyCallback cb5{c1, &Num::get}, cb6{c1, &Num::get};
+        THEN("Those with the same object and method are equal")
+        {
+            CHECK(cb1 == cb2);
+            CHECK(cb1.hash() == cb2.hash());
+            CHECK(cb5 == cb6);
+        }
+        THEN("Those with another object or another method are not equal")
+        {
+            CHECK(cb1 != cb3);
+            CHECK(cb1 != cb4);
+            CHECK(cb1 != cb5);
+        }
+    }
+    GIVEN("A callback and its copies")
+    {
+        MyCallback cb{n1, &Num::add};
+        MyCallback copy{cb};
+        THEN("They are equal")
+        {
+            CHECK(copy == cb);
+            CHECK(copy.hash() == cb.hash());
+        }
+        WHEN("A copy is moved")
+        {
+            MyCallback moved{move(copy)};
+            THEN("It is still equal") CHECK(moved == cb);
+        }
+    }
+    GIVEN("Empty callbacks")
+    {
+        MyCallback empty1, empty2{add1};
+        empty2 = nullptr;
+        THEN("They are equal") CHECK(empty1 == empty2);
+        THEN("They are not equal to other callbacks") CHECK(empty1 != MyCallback{add1});
+    }
+    GIVEN("Callbacks bound to functors")
+    {
+        NotTrivial functor;
+        MyCallback cb1{functor}, cb2{functor};
+        int a = 1;
+        MyCallback cb3{[&a](int i) { return a + i; }};
+        MyCallback cb4{cb3};
+        THEN("Trivially copyable ones are equal to their copies") CHECK(cb3 == cb4);
+        THEN("Others are only equal to themselves")
+        {
+            CHECK(cb1 != cb2);
+            CHECK(cb1 == cb1);
+        }
+    }
+}
+
+SCENARIO("Compact callbacks and delegates with the same target are equal", "[callback]")
+{
+    Num n1, n2;
+    GIVEN("Compact callbacks")
+    {
+        using Compact = CompactCallback<int(*)(int)>;
+        auto cb1 = Compact::bind<Num, &Num::add>(n1);
+        auto cb2 = Compact::bind<Num, &Num::add>(n1);
+        auto cb3 = Compact::bind<Num, &Num::add>(n2);
+        THEN("Those with the same target are equal")
+        {
+            CHECK(cb1 == cb2);
+            CHECK(cb1.hash() == cb2.hash());
+            CHECK(cb1 != cb3);
+            CHECK(Compact{add1} == Compact{add1});
+            CHECK(Compact{add1} != Compact{add2});
+            CHECK(Compact{} == Compact{});
+        }
+    }
+    GIVEN("Delegates")
+    {
+        using MyDelegate = Delegate<int(*)(int)>;
+        auto d1 = MyDelegate::bind<Num, &Num::add>(n1);
+        auto d2 = MyDelegate::bind<Num, &Num::add>(n1);
+        THEN("Those with the same target are equal")
+        {
+            CHECK(d1 == d2);
+            CHECK(d1.hash() == d2.hash());
+            CHECK(d1 != MyDelegate::bind<Num, &Num::sub>(n1));
+            CHECK(MyDelegate{add1} == MyDelegate{add1});
+            CHECK(MyDelegate::bind<add1>() != MyDelegate::bind<add2>());
+        }
+    }
+}
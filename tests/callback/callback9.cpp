@@ -0,0 +1,123 @@
+#include "ADVcallback.h"
+#include "ADVarena.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+namespace
+{
+    struct Large
+    {
+        Large() { ++constructed; }
+        Large(const Large&) { ++constructed; }
+        ~Large() { ++destroyed; }
+        int operator()(int i) const { return values_[0] + values_[7] + i; }
+
+        int values_[8] = {1, 0, 0, 0, 0, 0, 0, 2};
+        static int constructed;
+        static int destroyed;
+    };
+
+    int Large::constructed = 0;
+    int Large::destroyed = 0;
+
+    const size_t ALIGN = alignof(adv::max_align_t);
+    size_t rounded(size_t size) { return (size + ALIGN - 1) & ~(ALIGN - 1); }
+
+    using Arena = FrameArena<256>;
+    using ArenaCallback = Callback<int(*)(int), 16, CALLBACK_ALIGN, ArenaOverflow<Arena>>;
+}
+
+SCENARIO("A frame arena allocates by incrementing an offset", "[callback]")
+{
+    using SmallArena = FrameArena<64, Large>;
+    SmallArena::reset();
+    GIVEN("An empty arena")
+    {
+        WHEN("Memory is allocated")
+        {
+            void* p1 = SmallArena::allocate(1);
+            void* p2 = SmallArena::allocate(20);
+            THEN("Blocks are consecutive and aligned")
+            {
+                CHECK(static_cast<unsigned char*>(p2) - static_cast<unsigned char*>(p1) == static_cast<long>(ALIGN));
+                CHECK(SmallArena::used() == ALIGN + rounded(20));
+            }
+            THEN("An allocation too large fails") CHECK(SmallArena::allocate(64) == nullptr);
+            WHEN("The arena is reset")
+            {
+                SmallArena::reset();
+                THEN("All the memory is available") CHECK(SmallArena::allocate(64) != nullptr);
+            }
+        }
+    }
+}
+
+SCENARIO("Targets too large for a callback can be stored in a frame arena", "[callback]")
+{
+    Arena::reset();
+    Large::constructed = 0;
+    Large::destroyed = 0;
+    OverflowStats<ArenaOverflow<Arena>>::reset();
+
+    GIVEN("Callbacks with a large target that is not trivially destructible")
+    {
+        {
+            ArenaCallback cb{Large{}};
+            ArenaCallback copy{cb};
+            THEN("They can be called")
+            {
+                CHECK(cb(3) == 6);
+                CHECK(copy(4) == 7);
+            }
+            THEN("The targets and their destructors are in the arena")
+                CHECK(Arena::used() >= 2 * sizeof(Large));
+        }
+        THEN("The targets are not destroyed with the callbacks")
+        {
+            CHECK(Large::constructed - Large::destroyed == 2);
+            CHECK(OverflowStats<ArenaOverflow<Arena>>::live == 0);
+        }
+        WHEN("The arena is reset")
+        {
+            Arena::reset();
+            THEN("The targets are destroyed")
+            {
+                CHECK(Large::constructed == Large::destroyed);
+                CHECK(Arena::used() == 0);
+            }
+        }
+    }
+    GIVEN("A callback with a large trivially destructible target")
+    {
+        int values[6] = {1, 2, 3, 4, 5, 6};
+        ArenaCallback cb{[values](int i) { return values[0] + values[5] + i; }};
+        THEN("It can be called") CHECK(cb(1) == 8);
+        THEN("Only the target is allocated")
+            CHECK(Arena::used() == rounded(sizeof(values)));
+    }
+    GIVEN("An exhausted arena")
+    {
+        while(Arena::allocate(1) != nullptr) {}
+        ArenaCallback cb{Large{}};
+        THEN("The callback is empty") CHECK(!cb);
+        THEN("The failure is counted") CHECK(OverflowStats<ArenaOverflow<Arena>>::failed == 1);
+        THEN("No target is left") CHECK(Large::constructed == Large::destroyed);
+    }
+    GIVEN("An arena with room for a target but not for its destructor")
+    {
+        Arena::allocate(Arena::capacity - rounded(sizeof(Large)));
+        ArenaCallback cb{Large{}};
+        THEN("The callback is empty") CHECK(!cb);
+        THEN("Only the failure is counted")
+        {
+            using Stats = OverflowStats<ArenaOverflow<Arena>>;
+            CHECK(Stats::failed == 1);
+            CHECK(Stats::count == 0);
+            CHECK(Stats::live == 0);
+            CHECK(Stats::largest == 0);
+        }
+        THEN("No target is left") CHECK(Large::constructed == Large::destroyed);
+    }
+    Arena::reset();
+}
@@ -0,0 +1,103 @@
+#include "ADVcompact_callback.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+using MyCallback = CompactCallback<int(*)(int)>;
+
+namespace
+{
+    struct Num
+    {
+        int add(int i) { return n_ += i; }
+        int get(int i) const { return n_ + i; }
+        int n_ = 40;
+    };
+
+    int add1(int i) { return i + 1; }
+
+    struct Large { int operator()(int i) const { return i + a_ + b_ + c_; } long a_, b_, c_; };
+    struct NotTrivial { NotTrivial() = default; NotTrivial(const NotTrivial&) {} int operator()(int i) const { return i; } };
+}
+
+static_assert(sizeof(MyCallback) == 2 * sizeof(void*), "A CompactCallback has to be two words wide");
+static_assert(sizeof(MyCallback) * 2 <= sizeof(Callback<int(*)(int)>), "A CompactCallback is at most half a Callback");
+static_assert(is_trivially_copyable<MyCallback>::value, "A CompactCallback is copied byte by byte");
+static_assert(!MyCallback::fits<Large>(), "Large functors are rejected");
+static_assert(!MyCallback::fits<NotTrivial>(), "Functors not trivially copyable are rejected");
+
+SCENARIO("Compact callbacks can be bound in various ways", "[compact_callback]")
+{
+    WHEN("A callback is bound to a function")
+    {
+        MyCallback cb{&add1};
+        THEN("It can be called") CHECK(cb(41) == 42);
+        THEN("It is true") CHECK(cb);
+    }
+    WHEN("A callback is bound to a method")
+    {
+        Num num;
+        auto cb = MyCallback::bind<Num, &Num::add>(num);
+        THEN("It calls the method of the object")
+        {
+            CHECK(cb(2) == 42);
+            CHECK(num.n_ == 42);
+        }
+    }
+    WHEN("A callback is bound to a const method")
+    {
+        const Num num;
+        auto cb = MyCallback::bind<Num, &Num::get>(num);
+        THEN("It calls the const method of the object") CHECK(cb(2) == 42);
+    }
+    WHEN("A callback is bound to a lambda without capture")
+    {
+        MyCallback cb{[](int i) { return i * 2; }};
+        THEN("It can be called") CHECK(cb(21) == 42);
+    }
+    WHEN("A callback is bound to a lambda capturing a pointer")
+    {
+        int n = 40;
+        MyCallback cb{[p = &n](int i) { return *p += i; }};
+        THEN("It can be called and changes the captured value")
+        {
+            CHECK(cb(2) == 42);
+            CHECK(n == 42);
+        }
+    }
+}
+
+SCENARIO("Compact callbacks can be copied and reset", "[compact_callback]")
+{
+    GIVEN("A callback bound to a method")
+    {
+        Num num;
+        auto cb = MyCallback::bind<Num, &Num::add>(num);
+        WHEN("It is copied")
+        {
+            MyCallback copy = cb;
+            THEN("The copy calls the same object")
+            {
+                copy(1);
+                cb(1);
+                CHECK(num.n_ == 42);
+            }
+        }
+        WHEN("It is reset")
+        {
+            cb = nullptr;
+            THEN("It is false") CHECK(!cb);
+            THEN("It returns a default value") CHECK(cb(1) == 0);
+        }
+    }
+    GIVEN("A table of handlers")
+    {
+        MyCallback handlers[] = {MyCallback{&add1}, MyCallback{}, MyCallback{[](int i) { return -i; }}};
+        THEN("Empty handlers can be called")
+        {
+            CHECK(handlers[0](1) == 2);
+            CHECK(handlers[1](1) == 0);
+            CHECK(handlers[2](1) == -1);
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#include "ADVdelegate.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+using MyDelegate = Delegate<int(*)(int)>;
+
+namespace
+{
+    struct Num
+    {
+        int add(int i) { return n_ += i; }
+        int get(int i) const { return n_ + i; }
+        int n_ = 40;
+    };
+
+    int add1(int i) { return i + 1; }
+}
+
+static_assert(sizeof(MyDelegate) == 2 * sizeof(void*), "A Delegate has to be two pointers wide");
+
+SCENARIO("Delegates can be bound in various ways", "[delegate]")
+{
+    WHEN("A delegate is bound to a function")
+    {
+        auto d = MyDelegate::bind<add1>();
+        THEN("It can be called") CHECK(d(41) == 42);
+        THEN("It is true") CHECK(d);
+    }
+    WHEN("A delegate is bound to a method")
+    {
+        Num n;
+        auto d = MyDelegate::bind<Num, &Num::add>(n);
+        THEN("It can be called") CHECK(d(2) == 42);
+        THEN("It modifies the object")
+        {
+            d(1);
+            CHECK(n.n_ == 41);
+        }
+    }
+    WHEN("A delegate is bound to a const method")
+    {
+        const Num n;
+        auto d = MyDelegate::bind<Num, &Num::get>(n);
+        THEN("It can be called") CHECK(d(2) == 42);
+    }
+    WHEN("A delegate is empty")
+    {
+        MyDelegate d;
+        THEN("It can be called and returns a default value") CHECK(d(1) == 0);
+        THEN("It is false") CHECK_FALSE(d);
+    }
+    WHEN("A delegate is assigned a null pointer")
+    {
+        auto d = MyDelegate::bind<add1>();
+        d = nullptr;
+        THEN("It is false") CHECK_FALSE(d);
+    }
+    WHEN("A delegate is copied")
+    {
+        Num n;
+        auto d = MyDelegate::bind<Num, &Num::add>(n);
+        MyDelegate d2 = d;
+        THEN("The copy calls the same object") CHECK(d2(2) == 42);
+    }
+}
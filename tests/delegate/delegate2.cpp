@@ -0,0 +1,73 @@
+#include "ADVdelegate.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+using Handler = Delegate<int(*)(int)>;
+
+namespace
+{
+    struct Num
+    {
+        int add(int i) { return n_ += i; }
+        int get(int i) const { return n_ + i; }
+        int n_ = 40;
+    };
+
+    int add1(int i) { return i + 1; }
+    int add2(int i) { return i + 2; }
+
+    Num num;
+    const Num cnum;
+
+    // Constant-initialized: no static constructor is needed and the table can live in read-only memory.
+    // Declaring it constexpr is the check: it does not compile otherwise.
+    constexpr Handler handlers[] =
+    {
+        Handler::bind<add1>(),
+        Handler{add2},
+        Handler::bind<Num, &Num::add>(num),
+        Handler::bind<Num, &Num::get>(cnum),
+        Handler{}
+    };
+
+#if __cplusplus >= 201703L
+    constexpr Handler lambda_handler{[](int i){ return i * 2; }};
+#endif
+}
+
+SCENARIO("Delegates can be constant-initialized", "[delegate]")
+{
+    GIVEN("A constexpr table of delegates")
+    {
+        // Not static_assert: comparing the addresses of thunks is not a constant expression with -fsanitize=undefined
+        THEN("Only the last one is empty")
+        {
+            CHECK(handlers[0]);
+            CHECK(handlers[1]);
+            CHECK(handlers[2]);
+            CHECK(handlers[3]);
+            CHECK_FALSE(handlers[4]);
+#if __cplusplus >= 201703L
+            CHECK(lambda_handler(2) == 4);
+#endif
+        }
+        THEN("Its delegates can be called")
+        {
+            CHECK(handlers[0](1) == 2);
+            CHECK(handlers[1](1) == 3);
+            CHECK(handlers[3](2) == 42);
+            CHECK(handlers[4](1) == 0);
+        }
+        THEN("Its delegates call the bound objects")
+        {
+            handlers[2](2);
+            CHECK(num.n_ == 42);
+        }
+    }
+    GIVEN("A delegate constructed from a lambda without capture")
+    {
+        Handler handler{[](int i){ return i * 2; }};
+        THEN("It can be called") CHECK(handler(21) == 42);
+    }
+}
@@ -0,0 +1,105 @@
+#include "ADVfunction_ref.h"
+#include "ADVcallback.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+using MyFunctionRef = FunctionRef<int(*)(int)>;
+
+namespace
+{
+    struct Num
+    {
+        int add(int i) { return n_ += i; }
+        int get(int i) const { return n_ + i; }
+        int n_ = 40;
+    };
+
+    int add1(int i) { return i + 1; }
+
+    int sum(MyFunctionRef f, int n)
+    {
+        int r = 0;
+        for(int i = 0; i < n; ++i)
+            r += f(i);
+        return r;
+    }
+}
+
+static_assert(sizeof(MyFunctionRef) == 2 * sizeof(void*), "A FunctionRef has to be two pointers wide");
+
+namespace
+{
+    struct NotCallable {};
+    struct WrongArgument { int operator()(const char*) const { return 0; } };
+    struct WrongResult { const char* operator()(int) const { return nullptr; } };
+    struct ConvertibleResult { long operator()(int i) const { return i; } };
+}
+
+static_assert(!is_convertible<NotCallable&, MyFunctionRef>::value, "Only callables are referenced");
+static_assert(!is_convertible<WrongArgument&, MyFunctionRef>::value, "The arguments have to match");
+static_assert(!is_convertible<WrongResult&, MyFunctionRef>::value, "The result has to be convertible");
+static_assert(is_convertible<ConvertibleResult&, MyFunctionRef>::value, "A convertible result is accepted");
+static_assert(is_convertible<WrongResult&, FunctionRef<void(*)(int)>>::value, "Any result is accepted for void");
+
+SCENARIO("FunctionRefs can be constructed in various ways", "[function_ref]")
+{
+    WHEN("A FunctionRef is constructed from a function")
+    {
+        MyFunctionRef f{add1};
+        THEN("It can be called") CHECK(f(41) == 42);
+    }
+    WHEN("A FunctionRef is constructed from a lambda")
+    {
+        int a = 2;
+        auto lambda = [&a](int i){ return a * i; };
+        MyFunctionRef f{lambda};
+        THEN("It can be called") CHECK(f(21) == 42);
+        THEN("It references the lambda")
+        {
+            a = 3;
+            CHECK(f(2) == 6);
+        }
+    }
+    WHEN("A FunctionRef is constructed from a method")
+    {
+        Num n;
+        auto f = MyFunctionRef::bind<Num, &Num::add>(n);
+        THEN("It can be called") CHECK(f(2) == 42);
+        THEN("It modifies the object")
+        {
+            f(1);
+            CHECK(n.n_ == 41);
+        }
+    }
+    WHEN("A FunctionRef is constructed from a const method")
+    {
+        const Num n;
+        auto f = MyFunctionRef::bind<Num, &Num::get>(n);
+        THEN("It can be called") CHECK(f(2) == 42);
+    }
+    WHEN("A FunctionRef is constructed from a Callback")
+    {
+        Num n;
+        Callback<int(*)(int)> cb{n, &Num::add};
+        MyFunctionRef f{cb};
+        THEN("It calls the Callback") CHECK(f(2) == 42);
+    }
+    WHEN("A FunctionRef is copied")
+    {
+        int a = 2;
+        auto lambda = [&a](int i){ return a * i; };
+        MyFunctionRef f{lambda};
+        MyFunctionRef f2{f};
+        THEN("The copy references the same callable") CHECK(f2(4) == 8);
+    }
+}
+
+SCENARIO("FunctionRefs can be passed as parameters", "[function_ref]")
+{
+    GIVEN("A function taking a FunctionRef")
+    {
+        THEN("It accepts a lambda") CHECK(sum([](int i){ return i; }, 4) == 6);
+        THEN("It accepts a function") CHECK(sum(add1, 4) == 10);
+    }
+}
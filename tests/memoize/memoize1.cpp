@@ -0,0 +1,118 @@
+#include "ADVmemoize.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+namespace
+{
+    int calls = 0;
+    int square(int i) { ++calls; return i * i; }
+    long area(int width, short height) { ++calls; return static_cast<long>(width) * height; }
+
+    struct Table
+    {
+        int interpolate(int x) const { ++calls; return values_[x / 10] + (values_[x / 10 + 1] - values_[x / 10]) * (x % 10) / 10; }
+        int values_[4] = {0, 100, 400, 900};
+    };
+}
+
+SCENARIO("Results of a callback are remembered", "[memoize]")
+{
+    calls = 0;
+    GIVEN("A memoized function")
+    {
+        auto cached = memoize<4>(Callback<int(*)(int)>{square});
+        WHEN("It is called twice with the same argument")
+        {
+            CHECK(cached(3) == 9);
+            CHECK(cached(3) == 9);
+            THEN("The function is called only once")
+            {
+                CHECK(calls == 1);
+                CHECK(cached.hits() == 1);
+                CHECK(cached.misses() == 1);
+            }
+        }
+        WHEN("It is called with different arguments")
+        {
+            for(int i = 0; i < 4; ++i) CHECK(cached(i) == i * i);
+            THEN("Each result is remembered")
+            {
+                CHECK(calls == 4);
+                CHECK(cached.size() == 4);
+                CHECK(cached(2) == 4);
+                CHECK(calls == 4);
+            }
+        }
+        WHEN("More results than its capacity are computed")
+        {
+            for(int i = 0; i < 4; ++i) cached(i);
+            cached(0);   // 0 is now the most recently used, 1 the least
+            cached(10);  // Replaces 1
+            THEN("The least recently used result is forgotten")
+            {
+                calls = 0;
+                CHECK(cached(0) == 0);
+                CHECK(cached(2) == 4);
+                CHECK(cached(3) == 9);
+                CHECK(cached(10) == 100);
+                CHECK(calls == 0);
+                CHECK(cached(1) == 1);
+                CHECK(calls == 1);
+                CHECK(cached.size() == 4);
+            }
+        }
+        WHEN("It is cleared")
+        {
+            cached(3);
+            cached.clear();
+            cached.reset_statistics();
+            CHECK(cached(3) == 9);
+            THEN("The results are computed again")
+            {
+                CHECK(calls == 2);
+                CHECK(cached.misses() == 1);
+                CHECK(cached.hits() == 0);
+            }
+        }
+    }
+    GIVEN("A memoized function with several arguments")
+    {
+        auto cached = memoize<8>(Callback<long(*)(int, short)>{area});
+        CHECK(cached(3, 4) == 12);
+        CHECK(cached(4, 3) == 12);
+        CHECK(cached(3, 4) == 12);
+        THEN("The results are keyed on all the arguments")
+        {
+            CHECK(calls == 2);
+            CHECK(cached.hits() == 1);
+        }
+    }
+    GIVEN("A memoized method")
+    {
+        Table table;
+        auto cached = memoize<8>(Callback<int(*)(int)>{table, &Table::interpolate});
+        CHECK(cached(15) == 250);
+        CHECK(cached(15) == 250);
+        THEN("The method is called once") CHECK(calls == 1);
+    }
+}
+
+SCENARIO("Memoized callbacks stay consistent under many evictions", "[memoize]")
+{
+    calls = 0;
+    GIVEN("A small cache and many arguments")
+    {
+        auto cached = memoize<8>(Callback<int(*)(int)>{square});
+        bool correct = true;
+        for(int round = 0; round < 20; ++round)
+            for(int i = 0; i < 32; i += (round % 3) + 1)
+                correct = correct && cached((i * 7 + round) % 24) == ((i * 7 + round) % 24) * ((i * 7 + round) % 24);
+        THEN("All the results are correct")
+        {
+            CHECK(correct);
+            CHECK(cached.size() == 8);
+            CHECK(cached.misses() == static_cast<size_t>(calls));
+        }
+    }
+}
@@ -0,0 +1,189 @@
+#include "ADVobserver.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+namespace
+{
+    using Temperature = Subject<void(*)(int)>;
+
+    struct Display
+    {
+        explicit Display(Temperature& temperature) { temperature.connect(changed_); }
+        void refresh(int value) { value_ = value; ++refreshed_; }
+
+        int value_ = 0;
+        int refreshed_ = 0;
+        Observer<void(*)(int)> changed_{this, &Display::refresh};
+    };
+
+    struct OneShot
+    {
+        void fire(int) { ++fired_; changed_.disconnect(); }
+        int fired_ = 0;
+        Observer<void(*)(int)> changed_{this, &OneShot::fire};
+    };
+
+    int logged = 0;
+    void record(int value) { logged += value; }
+
+    // Disconnects or destroys another observer when called
+    struct Remover
+    {
+        void disconnect(int) { other_->changed_.disconnect(); }
+        void destroy(int) { delete other_; other_ = nullptr; }
+        Display* other_ = nullptr;
+    };
+}
+
+SCENARIO("Observers are called when the subject emits", "[observer]")
+{
+    logged = 0;
+    GIVEN("A subject and observers")
+    {
+        Temperature temperature;
+        Display display1{temperature}, display2{temperature};
+        Observer<void(*)(int)> logger{&record};
+        temperature.connect(logger);
+        THEN("They are connected")
+        {
+            CHECK(temperature.size() == 3);
+            CHECK(logger.connected());
+        }
+        WHEN("The subject emits")
+        {
+            temperature(42);
+            THEN("All the observers are called")
+            {
+                CHECK(display1.value_ == 42);
+                CHECK(display2.value_ == 42);
+                CHECK(logged == 42);
+            }
+        }
+        WHEN("An observer is disconnected")
+        {
+            display1.changed_.disconnect();
+            temperature(42);
+            THEN("It is not called anymore") CHECK(display1.refreshed_ == 0);
+            THEN("The others are called") CHECK(display2.refreshed_ == 1);
+            THEN("It can be disconnected twice") display1.changed_.disconnect();
+        }
+        WHEN("An observer is connected twice")
+        {
+            temperature.connect(logger);
+            temperature(1);
+            THEN("It is called only once") CHECK(logged == 1);
+        }
+        WHEN("The subject is cleared")
+        {
+            temperature.clear();
+            THEN("No observer is connected")
+            {
+                CHECK(temperature.empty());
+                CHECK(!logger.connected());
+            }
+        }
+    }
+}
+
+SCENARIO("Observers are disconnected when they are destroyed", "[observer]")
+{
+    GIVEN("A subject and an observer destroyed before it")
+    {
+        Temperature temperature;
+        Display display1{temperature};
+        {
+            Display display2{temperature};
+            Display display3{temperature};
+            CHECK(temperature.size() == 3);
+        }
+        THEN("Only the remaining observer is connected") CHECK(temperature.size() == 1);
+        WHEN("The subject emits")
+        {
+            temperature(42);
+            THEN("The remaining observer is called") CHECK(display1.value_ == 42);
+        }
+    }
+    GIVEN("An observer outliving its subject")
+    {
+        Observer<void(*)(int)> logger{&record};
+        {
+            Temperature temperature;
+            temperature.connect(logger);
+        }
+        THEN("It is not connected anymore") CHECK(!logger.connected());
+    }
+    GIVEN("An observer moved to another subject")
+    {
+        Temperature t1, t2;
+        Display display{t1};
+        t2.connect(display.changed_);
+        THEN("It is only connected to the last one")
+        {
+            CHECK(t1.empty());
+            CHECK(t2.size() == 1);
+        }
+    }
+}
+
+SCENARIO("Observers can disconnect themselves while called", "[observer]")
+{
+    GIVEN("A subject with a one-shot observer between others")
+    {
+        Temperature temperature;
+        Display display1{temperature};
+        OneShot shot;
+        temperature.connect(shot.changed_);
+        Display display2{temperature};
+        WHEN("The subject emits twice")
+        {
+            temperature(1);
+            temperature(2);
+            THEN("The one-shot observer is called once, the others twice")
+            {
+                CHECK(shot.fired_ == 1);
+                CHECK(display1.refreshed_ == 2);
+                CHECK(display2.refreshed_ == 2);
+            }
+        }
+    }
+}
+
+SCENARIO("Observers can disconnect or destroy the next observers while called", "[observer]")
+{
+    GIVEN("A subject calling a remover, then a display, then another display")
+    {
+        Temperature temperature;
+        Display last{temperature};
+        auto next = new Display{temperature};
+        Remover remover{};
+        remover.other_ = next;
+
+        WHEN("The remover disconnects the next display")
+        {
+            Observer<void(*)(int)> removing{&remover, &Remover::disconnect};
+            temperature.connect(removing);
+            temperature(1);
+            THEN("The next display is not called, the last one is")
+            {
+                CHECK(next->refreshed_ == 0);
+                CHECK(last.refreshed_ == 1);
+                CHECK(temperature.size() == 2);
+            }
+            delete next;
+        }
+
+        WHEN("The remover destroys the next display")
+        {
+            Observer<void(*)(int)> removing{&remover, &Remover::destroy};
+            temperature.connect(removing);
+            temperature(1);
+            THEN("The last display is called")
+            {
+                CHECK(remover.other_ == nullptr);
+                CHECK(last.refreshed_ == 1);
+                CHECK(temperature.size() == 2);
+            }
+        }
+    }
+}
@@ -0,0 +1,179 @@
+#include "ADVpriority_task_queue.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+namespace
+{
+    int order[16];
+    int executed = 0;
+    void run(int n) { order[executed++] = n; }
+
+    enum Priority: unsigned char { LOW = 1, NORMAL = 5, URGENT = 10 };
+
+    PriorityTaskQueue<8>* current = nullptr;
+}
+
+SCENARIO("Tasks are run by priority", "[priority_task_queue]")
+{
+    executed = 0;
+    GIVEN("A queue with tasks of various priorities")
+    {
+        PriorityTaskQueue<8> queue;
+        queue.post(LOW, Callback<void(*)()>{[]{ run(1); }});
+        queue.post(NORMAL, Callback<void(*)()>{[]{ run(2); }});
+        queue.post(URGENT, Callback<void(*)()>{[]{ run(3); }});
+        queue.post(NORMAL, Callback<void(*)()>{[]{ run(4); }});
+        queue.post(LOW, Callback<void(*)()>{[]{ run(5); }});
+        THEN("They are all queued")
+        {
+            CHECK(queue.size() == 5);
+            CHECK(queue.top_priority() == URGENT);
+        }
+        WHEN("They are run")
+        {
+            CHECK(queue.run_pending() == 5);
+            THEN("They are run by priority, then in the order they were posted")
+            {
+                CHECK(executed == 5);
+                CHECK(order[0] == 3);
+                CHECK(order[1] == 2);
+                CHECK(order[2] == 4);
+                CHECK(order[3] == 1);
+                CHECK(order[4] == 5);
+                CHECK(queue.empty());
+            }
+        }
+    }
+    GIVEN("A full queue")
+    {
+        PriorityTaskQueue<4> queue;
+        for(int i = 0; i < 4; ++i) CHECK(queue.post(NORMAL, Callback<void(*)()>{[]{ run(0); }}));
+        WHEN("Another task is posted")
+        {
+            auto handle = queue.post(URGENT, Callback<void(*)()>{[]{ run(1); }});
+            THEN("It is rejected")
+            {
+                CHECK_FALSE(handle);
+                CHECK(queue.full());
+            }
+        }
+    }
+}
+
+SCENARIO("The priority of a pending task can be changed", "[priority_task_queue]")
+{
+    executed = 0;
+    GIVEN("A queue with tasks")
+    {
+        PriorityTaskQueue<8> queue;
+        auto h1 = queue.post(LOW, Callback<void(*)()>{[]{ run(1); }});
+        queue.post(NORMAL, Callback<void(*)()>{[]{ run(2); }});
+        auto h3 = queue.post(NORMAL, Callback<void(*)()>{[]{ run(3); }});
+        WHEN("The priority of a task is raised")
+        {
+            CHECK(queue.change_priority(h1, URGENT));
+            queue.run_pending();
+            THEN("It runs first") CHECK((order[0] == 1 && order[1] == 2 && order[2] == 3));
+        }
+        WHEN("The priority of a task is lowered")
+        {
+            CHECK(queue.change_priority(h3, LOW));
+            queue.run_pending();
+            THEN("It runs after the tasks posted before it with the same priority")
+                CHECK((order[0] == 2 && order[1] == 1 && order[2] == 3));
+        }
+        WHEN("A task is cancelled")
+        {
+            CHECK(queue.cancel(h3));
+            queue.run_pending();
+            THEN("It is not run")
+            {
+                CHECK(executed == 2);
+                CHECK_FALSE(h3);
+            }
+        }
+        WHEN("A task has run")
+        {
+            queue.change_priority(h1, URGENT);
+            queue.run_next();
+            THEN("Its handle is not pending anymore")
+            {
+                CHECK_FALSE(queue.pending(h1));
+                CHECK_FALSE(queue.change_priority(h1, LOW));
+                CHECK_FALSE(queue.cancel(h1));
+            }
+            WHEN("Its slot is reused")
+            {
+                queue.post(LOW, Callback<void(*)()>{[]{ run(4); }});
+                THEN("The old handle still does not change it") CHECK_FALSE(queue.cancel(h1));
+            }
+        }
+    }
+}
+
+SCENARIO("Tasks can post urgent tasks", "[priority_task_queue]")
+{
+    executed = 0;
+    GIVEN("A task posting an urgent task")
+    {
+        PriorityTaskQueue<8> queue;
+        current = &queue;
+        queue.post(NORMAL, Callback<void(*)()>{[]{ run(1); current->post(URGENT, Callback<void(*)()>{[]{ run(2); }}); }});
+        queue.post(NORMAL, Callback<void(*)()>{[]{ run(3); }});
+        WHEN("The queue is run")
+        {
+            queue.run_pending();
+            THEN("The urgent task runs before the other pending ones")
+                CHECK((executed == 2 && order[0] == 1 && order[1] == 2));
+            THEN("The other one is still pending") CHECK(queue.size() == 1);
+        }
+    }
+    GIVEN("Many tasks posted and cancelled")
+    {
+        PriorityTaskQueue<8> queue;
+        PriorityTaskQueue<8>::Handle handles[8];
+        for(int i = 0; i < 8; ++i) handles[i] = queue.post(static_cast<unsigned char>(i % 3), Callback<void(*)()>{[]{ run(0); }});
+        for(int i = 0; i < 8; i += 2) CHECK(queue.cancel(handles[i]));
+        WHEN("The others are run")
+        {
+            int last = 255;
+            bool ordered = true;
+            while(!queue.empty())
+            {
+                int priority = queue.top_priority();
+                ordered = ordered && priority <= last;
+                last = priority;
+                queue.run_next();
+            }
+            THEN("They are run by decreasing priority")
+            {
+                CHECK(ordered);
+                CHECK(executed == 4);
+            }
+        }
+    }
+}
+
+SCENARIO("A task can clear the priority queue", "[priority_task_queue]")
+{
+    executed = 0;
+    GIVEN("An urgent task clearing the queue and other tasks")
+    {
+        PriorityTaskQueue<8> queue;
+        current = &queue;
+        queue.post(URGENT, Callback<void(*)()>{[]{ run(1); current->clear(); }});
+        queue.post(NORMAL, Callback<void(*)()>{[]{ run(2); }});
+        queue.post(LOW, Callback<void(*)()>{[]{ run(3); }});
+        WHEN("The pending tasks are run")
+        {
+            auto ran = queue.run_pending();
+            THEN("Only the urgent task is run")
+            {
+                CHECK(ran == 1);
+                CHECK(executed == 1);
+                CHECK(queue.empty());
+            }
+        }
+    }
+}
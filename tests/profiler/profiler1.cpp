@@ -0,0 +1,163 @@
+#include "ADVcallback.h"
+#include "ADVprofiler.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+namespace
+{
+    struct Tag {};
+    using Profiler = InvocationProfiler<4, Tag>;
+
+    ProfileTicks ticks = 0;
+    unsigned long reads = 0;
+    ProfileTicks now() { ++reads; return ticks; }
+
+    void f1() {}
+    void f2() {}
+    void f3() {}
+    void f4() {}
+    void slow() { ticks += 10; }
+
+    Profiler::Identity id(void(*f)()) { return f; }
+}
+
+SCENARIO("The profiler records counts and ticks per target", "[profiler]")
+{
+    Profiler::reset();
+    Profiler::set_clock(&now);
+    GIVEN("Some recorded invocations")
+    {
+        int object;
+        Profiler::record(id(&f1), nullptr, 5);
+        Profiler::record(id(&f1), nullptr, 7);
+        Profiler::record(id(&f1), &object, 100);
+        Profiler::record(id(&f2), nullptr, 50);
+        THEN("Each target is recorded separately")
+        {
+            CHECK(Profiler::size() == 3);
+            CHECK(Profiler::dropped() == 0);
+        }
+        WHEN("The top targets are requested")
+        {
+            Profiler::Entry top[2];
+            CHECK(Profiler::top(top, 2) == 2);
+            THEN("They are sorted by ticks")
+            {
+                CHECK(top[0].invoker == id(&f1));
+                CHECK(top[0].target == &object);
+                CHECK(top[0].count == 1);
+                CHECK(top[0].ticks == 100);
+                CHECK(top[1].invoker == id(&f2));
+                CHECK(top[1].ticks == 50);
+            }
+        }
+        WHEN("More targets than the capacity are recorded")
+        {
+            Profiler::record(id(&f3), nullptr, 1);
+            Profiler::record(id(&f4), nullptr, 1);
+            THEN("The others are dropped")
+            {
+                CHECK(Profiler::size() == Profiler::capacity());
+                CHECK(Profiler::dropped() == 1);
+            }
+            WHEN("All the targets are requested")
+            {
+                Profiler::Entry top[8];
+                CHECK(Profiler::top(top, 8) == 4);
+                THEN("The first one is recorded with all its invocations")
+                {
+                    CHECK(top[0].ticks == 100);
+                    CHECK(top[1].ticks == 50);
+                    CHECK(top[2].count == 2);
+                    CHECK(top[2].ticks == 12);
+                }
+            }
+        }
+        WHEN("The profiler is reset")
+        {
+            Profiler::reset();
+            THEN("Nothing is recorded") CHECK(Profiler::size() == 0);
+        }
+    }
+}
+
+SCENARIO("A profiler scope measures its lifetime", "[profiler]")
+{
+    Profiler::reset();
+    Profiler::set_clock(&now);
+    GIVEN("A scope around a slow function")
+    {
+        { Profiler::Scope scope{id(&slow), nullptr}; slow(); }
+        THEN("Its ticks are recorded")
+        {
+            Profiler::Entry top[1];
+            CHECK(Profiler::top(top, 1) == 1);
+            CHECK(top[0].count == 1);
+            CHECK(top[0].ticks == 10);
+        }
+    }
+}
+
+#ifdef ADV_PROFILE_CALLBACKS
+
+SCENARIO("Callbacks are profiled", "[profiler]")
+{
+    CallbackProfiler::reset();
+    CallbackProfiler::set_clock(&now);
+    GIVEN("Two callbacks")
+    {
+        Callback<void(*)()> cb1{&f1};
+        Callback<void(*)()> cb2{&slow};
+        WHEN("They are called")
+        {
+            cb1(); cb1(); cb2();
+            THEN("Each target is recorded")
+            {
+                CallbackProfiler::Entry top[2];
+                CHECK(CallbackProfiler::top(top, 2) == 2);
+                CHECK(top[0].ticks == 10);
+                CHECK(top[0].count == 1);
+                CHECK(top[1].count == 2);
+            }
+        }
+    }
+    GIVEN("An empty callback")
+    {
+        Callback<void(*)()> cb;
+        WHEN("It is called")
+        {
+            cb(); cb();
+            THEN("Nothing is recorded") CHECK(CallbackProfiler::size() == 0);
+        }
+    }
+    CallbackProfiler::set_clock(nullptr);
+}
+
+#else
+
+SCENARIO("Callbacks are not profiled by default", "[profiler]")
+{
+    using Profiled = InvocationProfiler<ADV_PROFILE_ENTRIES>;
+    static_assert(callback_traits<Callback<void(*)()>>::overhead == 2 * sizeof(void*), "No storage is added");
+
+    Profiled::reset();
+    Profiled::set_clock(&now);
+    GIVEN("A callback")
+    {
+        Callback<void(*)()> cb{&slow};
+        WHEN("It is called")
+        {
+            reads = 0;
+            cb();
+            THEN("Nothing is measured nor recorded")
+            {
+                CHECK(reads == 0);
+                CHECK(Profiled::size() == 0);
+            }
+        }
+    }
+    Profiled::set_clock(nullptr);
+}
+
+#endif
@@ -0,0 +1,195 @@
+#include "ADVresumable.h"
+#include "ADVtask_queue.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+namespace
+{
+    int temperature = 20;
+
+    // The Stepper of task_queue1, written as straight-line code
+    struct Heat: Resumable<Heat>
+    {
+        bool resume()
+        {
+            ADV_BEGIN();
+            steps_ = 1;
+            ADV_YIELD();
+            steps_ = 2;
+            ADV_AWAIT(temperature >= 200);
+            steps_ = 3;
+            ADV_END();
+        }
+
+        int steps_ = 0;
+    };
+
+    struct Counter: Resumable<Counter>
+    {
+        bool resume()
+        {
+            ADV_BEGIN();
+            for(i_ = 0; i_ < 3; ++i_)
+            {
+                ++count_;
+                ADV_YIELD();
+            }
+            ADV_END();
+        }
+
+        int i_ = 0;
+        int count_ = 0;
+    };
+}
+
+SCENARIO("A resumable task is resumed where it was suspended", "[resumable]")
+{
+    temperature = 20;
+    GIVEN("A task")
+    {
+        Heat heat;
+        THEN("It has not run") CHECK(heat.steps_ == 0);
+        WHEN("It is resumed")
+        {
+            CHECK(heat.resume());
+            THEN("It runs up to the first yield") CHECK(heat.steps_ == 1);
+            WHEN("It is resumed again")
+            {
+                CHECK(heat.resume());
+                CHECK(heat.resume());
+                THEN("It waits for the condition")
+                {
+                    CHECK(heat.steps_ == 2);
+                    CHECK(!heat.finished());
+                }
+                WHEN("The condition becomes true")
+                {
+                    temperature = 200;
+                    CHECK(!heat.resume());
+                    THEN("It runs to the end")
+                    {
+                        CHECK(heat.steps_ == 3);
+                        CHECK(heat.finished());
+                    }
+                    WHEN("It is resumed once finished")
+                    {
+                        CHECK(!heat.resume());
+                        THEN("Nothing is run again") CHECK(heat.steps_ == 3);
+                    }
+                    WHEN("It is restarted")
+                    {
+                        heat.restart();
+                        CHECK(heat.resume());
+                        THEN("It runs from the beginning") CHECK(heat.steps_ == 1);
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("A resumable task can yield inside a loop", "[resumable]")
+{
+    GIVEN("A task counting with yields")
+    {
+        Counter counter;
+        WHEN("It is resumed until finished")
+        {
+            int resumes = 1;
+            while(counter.resume()) ++resumes;
+            THEN("Each iteration is run once")
+            {
+                CHECK(counter.count_ == 3);
+                CHECK(resumes == 4);
+            }
+        }
+    }
+}
+
+SCENARIO("Resumable tasks are scheduled from a task queue", "[resumable]")
+{
+    temperature = 20;
+    GIVEN("Two tasks started in a queue")
+    {
+        TaskQueue<4> queue;
+        Heat heat;
+        Counter counter;
+        CHECK(start_in(queue, heat));
+        CHECK(start_in(queue, counter));
+        WHEN("The queue is run once")
+        {
+            CHECK(queue.run_pending() == 2);
+            THEN("Each task has been resumed once")
+            {
+                CHECK(heat.steps_ == 1);
+                CHECK(counter.count_ == 1);
+                CHECK(queue.size() == 2);
+            }
+            WHEN("The queue is run until empty")
+            {
+                temperature = 200;
+                while(!queue.empty()) queue.run_pending();
+                THEN("Both tasks are finished")
+                {
+                    CHECK(heat.finished());
+                    CHECK(counter.finished());
+                    CHECK(counter.count_ == 3);
+                }
+            }
+        }
+    }
+}
+
+namespace
+{
+    using SmallQueue = TaskQueue<1>;
+    void nothing() {}
+
+    // Fills its queue before it is posted again
+    struct Filler: Resumable<Filler>
+    {
+        explicit Filler(SmallQueue& queue): queue_(queue) {}
+
+        bool resume()
+        {
+            ADV_BEGIN();
+            queue_.post(SmallQueue::Task{nothing});
+            ADV_YIELD();
+            ADV_END();
+        }
+
+        SmallQueue& queue_;
+    };
+}
+
+SCENARIO("A resumable task is stalled when its queue is full", "[resumable]")
+{
+    GIVEN("A task filling its queue")
+    {
+        SmallQueue queue;
+        Filler filler{queue};
+        CHECK(start_in(queue, filler));
+        WHEN("It is resumed")
+        {
+            queue.run_pending();
+            THEN("It can not be posted again and it is stalled")
+            {
+                CHECK(filler.stalled());
+                CHECK_FALSE(filler.finished());
+                CHECK(queue.dropped() == 1);
+            }
+            WHEN("It is started again once there is room")
+            {
+                queue.run_pending();
+                CHECK(start_in(queue, filler));
+                queue.run_pending();
+                THEN("It runs to its end")
+                {
+                    CHECK_FALSE(filler.stalled());
+                    CHECK(filler.finished());
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,344 @@
+#include "ADVsignal.h"
+#include "ADVdelegate.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+namespace
+{
+    struct Display
+    {
+        void refresh(int value) { value_ = value; }
+        int value_ = 0;
+    };
+
+    int logged = 0;
+    void log(int value) { logged += value; }
+    void twice_log(int value) { logged += 2 * value; }
+
+    int twice(int i) { return 2 * i; }
+    int thrice(int i) { return 3 * i; }
+}
+
+SCENARIO("Slots can be connected to and disconnected from a signal", "[signal]")
+{
+    using MySignal = Signal<void(*)(int), 4>;
+    using Slot = Callback<void(*)(int)>;
+    logged = 0;
+
+    GIVEN("A signal with two slots connected")
+    {
+        MySignal signal;
+        Display display;
+        auto c1 = signal.connect(Slot{display, &Display::refresh});
+        auto c2 = signal.connect(Slot{log});
+
+        THEN("The connections are valid")
+        {
+            CHECK(c1);
+            CHECK(c2);
+            CHECK(signal.size() == 2);
+        }
+        WHEN("It is emitted")
+        {
+            signal.emit(42);
+            THEN("All the slots are called")
+            {
+                CHECK(display.value_ == 42);
+                CHECK(logged == 42);
+            }
+        }
+        WHEN("A slot is disconnected")
+        {
+            CHECK(signal.disconnect(c1));
+            signal(43);
+            THEN("It is not called anymore") CHECK(display.value_ == 0);
+            THEN("The other slots are called") CHECK(logged == 43);
+            THEN("The connection is invalid") CHECK_FALSE(c1);
+            THEN("It can not be disconnected twice") CHECK_FALSE(signal.disconnect(c1));
+        }
+        WHEN("A slot is disconnected and another is connected")
+        {
+            signal.disconnect(c1);
+            auto c3 = signal.connect(Slot{display, &Display::refresh});
+            THEN("The other connections are still valid")
+            {
+                CHECK(signal.disconnect(c2));
+                signal.emit(44);
+                CHECK(logged == 0);
+                CHECK(display.value_ == 44);
+                CHECK(signal.disconnect(c3));
+                CHECK(signal.empty());
+            }
+        }
+        WHEN("It is full")
+        {
+            signal.connect(Slot{log});
+            signal.connect(Slot{log});
+            auto c5 = signal.connect(Slot{log});
+            THEN("A slot can not be connected") CHECK_FALSE(c5);
+            THEN("It is full") CHECK(signal.full());
+        }
+        WHEN("It is cleared")
+        {
+            signal.clear();
+            signal.emit(45);
+            THEN("No slot is called") CHECK(logged == 0);
+        }
+    }
+}
+
+SCENARIO("The results of the slots of a signal can be combined", "[signal]")
+{
+    using MySignal = Signal<int(*)(int), 4, Delegate<int(*)(int)>>;
+    using Slot = Delegate<int(*)(int)>;
+
+    GIVEN("A signal with two slots returning a value")
+    {
+        MySignal signal;
+        signal.connect(Slot::bind<twice>());
+        signal.connect(Slot::bind<thrice>());
+        THEN("Their results can be summed") CHECK(signal.collect(SumResults<int>{}, 2).result == 10);
+        THEN("The last result can be kept") CHECK(signal.collect(LastResult<int>{}, 2).result == 6);
+    }
+    GIVEN("A signal whose first slot disconnects the last one")
+    {
+        using CollectingSignal = Signal<int(*)(int), 4>;
+        CollectingSignal signal;
+        using Slot = Callback<int(*)(int)>;
+        CollectingSignal::Connection last;
+        signal.connect(Slot{[&](int i) { signal.disconnect(last); return twice(i); }});
+        last = signal.connect(Slot{thrice});
+        THEN("The disconnected slot is not combined") CHECK(signal.collect(LastResult<int>{}, 2).result == 4);
+    }
+}
+
+SCENARIO("Slots can be disconnected without their connection", "[signal]")
+{
+    using MySignal = Signal<void(*)(int), 16>;
+    using Slot = Callback<void(*)(int)>;
+    logged = 0;
+
+    GIVEN("A signal with many slots connected")
+    {
+        MySignal signal;
+        Display displays[12];
+        for(auto& display: displays) signal.connect(Slot{display, &Display::refresh});
+        signal.connect(Slot{log});
+
+        WHEN("Slots are disconnected by object and method")
+        {
+            for(int i = 0; i < 12; i += 2) CHECK(signal.disconnect(displays[i], &Display::refresh));
+            signal(42);
+            THEN("They are not called anymore")
+            {
+                for(int i = 0; i < 12; ++i) CHECK(displays[i].value_ == (i % 2 == 0 ? 0 : 42));
+                CHECK(logged == 42);
+                CHECK(signal.size() == 7);
+            }
+            THEN("They can not be disconnected twice") CHECK_FALSE(signal.disconnect(displays[0], &Display::refresh));
+            THEN("The others are still connected")
+            {
+                for(int i = 1; i < 12; i += 2) CHECK(signal.connected(Slot{displays[i], &Display::refresh}));
+                CHECK(signal.connected(Slot{log}));
+            }
+        }
+        WHEN("A slot is disconnected by function")
+        {
+            CHECK(signal.disconnect(Slot{log}));
+            signal(1);
+            THEN("It is not called anymore") CHECK(logged == 0);
+        }
+        WHEN("All the slots are disconnected one by one")
+        {
+            CHECK(signal.disconnect(Slot{log}));
+            for(auto& display: displays) CHECK(signal.disconnect(display, &Display::refresh));
+            THEN("The signal is empty") CHECK(signal.empty());
+        }
+        WHEN("The signal is cleared")
+        {
+            signal.clear();
+            THEN("No slot is connected anymore") CHECK_FALSE(signal.connected(Slot{log}));
+        }
+    }
+    GIVEN("A signal of delegates")
+    {
+        using DelegateSignal = Signal<int(*)(int), 4, Delegate<int(*)(int)>>;
+        DelegateSignal signal;
+        signal.connect(Delegate<int(*)(int)>{twice});
+        signal.connect(Delegate<int(*)(int)>{thrice});
+        WHEN("A delegate is disconnected by value")
+        {
+            CHECK(signal.disconnect(Delegate<int(*)(int)>{twice}));
+            THEN("Only the other one is called") CHECK(signal.collect(SumResults<int>{}, 1).result == 3);
+        }
+    }
+}
+
+namespace
+{
+    using ReentrantSignal = Signal<void(*)(int), 8>;
+
+    // Disconnects a slot when called, then uses its own state
+    struct Disconnecting
+    {
+        void operator()(int value)
+        {
+            if(connection_ != nullptr) signal_->disconnect(*connection_);
+            logged += value * weight_;
+        }
+        ReentrantSignal* signal_;
+        ReentrantSignal::Connection* connection_;
+        int weight_;
+    };
+
+    struct Reemitting
+    {
+        void operator()(int value)
+        {
+            logged += value * weight_;
+            if(!*connection_) return;
+            signal_->disconnect(*connection_);
+            signal_->emit(value);
+        }
+        ReentrantSignal* signal_;
+        ReentrantSignal::Connection* connection_;
+        int weight_;
+    };
+
+    struct Clearing
+    {
+        void operator()(int value) { signal_->clear(); logged += value * weight_; }
+        ReentrantSignal* signal_;
+        int weight_;
+    };
+}
+
+SCENARIO("Slots can be disconnected while the signal is emitted", "[signal]")
+{
+    using Slot = Callback<void(*)(int)>;
+    logged = 0;
+
+    GIVEN("A signal whose first slot disconnects itself")
+    {
+        ReentrantSignal signal;
+        ReentrantSignal::Connection connections[4];
+        connections[0] = signal.connect(Slot{Disconnecting{&signal, &connections[0], 1}});
+        connections[1] = signal.connect(Slot{Disconnecting{&signal, nullptr, 10}});
+        connections[2] = signal.connect(Slot{Disconnecting{&signal, nullptr, 100}});
+        connections[3] = signal.connect(Slot{Disconnecting{&signal, nullptr, 1000}});
+        WHEN("It is emitted")
+        {
+            signal(1);
+            THEN("The slot keeps its state while it runs and all the slots are called")
+            {
+                CHECK(logged == 1111);
+                CHECK(signal.size() == 3);
+            }
+            THEN("The slot is not called anymore")
+            {
+                signal(1);
+                CHECK(logged == 1111 + 1110);
+            }
+            THEN("The other connections are still valid")
+            {
+                CHECK_FALSE(signal.disconnect(connections[0]));
+                CHECK(signal.disconnect(connections[3]));
+                CHECK(signal.disconnect(connections[1]));
+                CHECK(signal.size() == 1);
+                signal(1);
+                CHECK(logged == 1111 + 100);
+            }
+        }
+    }
+    GIVEN("A signal whose first slot disconnects the last one")
+    {
+        ReentrantSignal signal;
+        ReentrantSignal::Connection last;
+        signal.connect(Slot{Disconnecting{&signal, &last, 1}});
+        signal.connect(Slot{Disconnecting{&signal, nullptr, 10}});
+        last = signal.connect(Slot{Disconnecting{&signal, nullptr, 100}});
+        WHEN("It is emitted")
+        {
+            signal(1);
+            THEN("The disconnected slot is not called")
+            {
+                CHECK(logged == 11);
+                CHECK(signal.size() == 2);
+            }
+        }
+    }
+    GIVEN("A signal whose first slot clears it")
+    {
+        ReentrantSignal signal;
+        signal.connect(Slot{Clearing{&signal, 1}});
+        signal.connect(Slot{Disconnecting{&signal, nullptr, 10}});
+        WHEN("It is emitted")
+        {
+            signal(1);
+            THEN("Only the first slot is called and the signal is empty")
+            {
+                CHECK(logged == 1);
+                CHECK(signal.empty());
+            }
+            THEN("Slots can be connected again")
+            {
+                CHECK(signal.connect(Slot{log}));
+                signal(2);
+                CHECK(logged == 3);
+            }
+        }
+    }
+    GIVEN("A signal whose first slot disconnects itself and emits it again")
+    {
+        ReentrantSignal signal;
+        ReentrantSignal::Connection first;
+        first = signal.connect(Slot{Reemitting{&signal, &first, 1}});
+        signal.connect(Slot{Disconnecting{&signal, nullptr, 10}});
+        WHEN("It is emitted")
+        {
+            signal(1);
+            THEN("The first slot is called once and the other one twice")
+            {
+                CHECK(logged == 21);
+                CHECK(signal.size() == 1);
+            }
+        }
+    }
+}
+
+SCENARIO("Stale connections do not disconnect other slots", "[signal]")
+{
+    using Slot = Callback<void(*)(int)>;
+    logged = 0;
+
+    GIVEN("A copy of a connection whose slot was disconnected")
+    {
+        ReentrantSignal signal;
+        auto connection = signal.connect(Slot{log});
+        auto copy = connection;
+        CHECK(signal.disconnect(connection));
+        WHEN("Another slot is connected with the same identifier")
+        {
+            auto other = signal.connect(Slot{twice_log});
+            THEN("The copy does not disconnect it")
+            {
+                CHECK_FALSE(signal.disconnect(copy));
+                CHECK(signal.size() == 1);
+                CHECK(signal.disconnect(other));
+            }
+        }
+        WHEN("The signal is cleared and a slot is connected")
+        {
+            auto other = signal.connect(Slot{twice_log});
+            auto other_copy = other;
+            signal.clear();
+            signal.connect(Slot{log});
+            THEN("The old connections are invalid")
+            {
+                CHECK_FALSE(signal.disconnect(other_copy));
+                CHECK(signal.size() == 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,111 @@
+#include <thread>
+#include "ADVspsc_queue.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+using Task = Callback<void(*)()>;
+
+namespace
+{
+    int executed = 0;
+    int last = -1;
+    bool in_order = true;
+
+    void record(int n) { if(n != last + 1) in_order = false; last = n; ++executed; }
+}
+
+SCENARIO("Tasks can be pushed to and popped from a SPSC queue", "[spsc_queue]")
+{
+    executed = 0;
+    last = -1;
+    in_order = true;
+
+    GIVEN("A queue with two tasks")
+    {
+        SpscQueue<4> queue;
+        CHECK(queue.push(Task{[]{ record(0); }}));
+        CHECK(queue.push(Task{[]{ record(1); }}));
+        THEN("It has two tasks") CHECK(queue.size() == 2);
+        WHEN("A task is popped")
+        {
+            Task task;
+            REQUIRE(queue.pop(task));
+            task();
+            THEN("It is the first one") CHECK(last == 0);
+            THEN("The other is still queued") CHECK(queue.size() == 1);
+        }
+        WHEN("The tasks are run")
+        {
+            CHECK(queue.run_pending() == 2);
+            THEN("They are run in order")
+            {
+                CHECK(executed == 2);
+                CHECK(in_order);
+            }
+            THEN("The queue is empty") CHECK(queue.empty());
+        }
+        WHEN("The queue is filled")
+        {
+            queue.push(Task{[]{ record(2); }});
+            queue.push(Task{[]{ record(3); }});
+            THEN("Other tasks are rejected") CHECK_FALSE(queue.push(Task{[]{ record(4); }}));
+        }
+    }
+    GIVEN("A queue and a batch of tasks")
+    {
+        SpscQueue<4> queue;
+        {
+            SpscQueue<4>::Batch batch{queue};
+            for(int i = 0; i < 3; ++i) CHECK(batch.push(Task{[i]{ record(i); }}));
+            THEN("The tasks are not visible before the commit") CHECK(queue.empty());
+            batch.commit();
+            THEN("The tasks are visible after the commit") CHECK(queue.size() == 3);
+            THEN("The batch can not exceed the capacity")
+            {
+                CHECK(batch.push(Task{[]{ record(3); }}));
+                CHECK_FALSE(batch.push(Task{[]{ record(4); }}));
+            }
+        }
+        WHEN("The tasks are run")
+        {
+            queue.run_pending();
+            THEN("They are run in order") CHECK(in_order);
+        }
+    }
+}
+
+SCENARIO("A SPSC queue can be used by two threads", "[spsc_queue]")
+{
+    executed = 0;
+    last = -1;
+    in_order = true;
+
+    GIVEN("A producer thread and a consumer thread")
+    {
+        const int ITEMS = 20000;
+        static SpscQueue<64> queue;
+
+        std::thread producer{[]
+        {
+            for(int i = 0; i < ITEMS;)
+            {
+                SpscQueue<64>::Batch batch{queue};
+                int n = 0;
+                for(; n < 8 && i < ITEMS && batch.push(Task{[i]{ record(i); }}); ++n) ++i;
+                if(n == 0) std::this_thread::yield(); // Full
+            }
+        }};
+
+        while(executed < ITEMS)
+            if(queue.run_pending() == 0) std::this_thread::yield();
+        producer.join();
+
+        THEN("All the tasks are run in order")
+        {
+            CHECK(executed == ITEMS);
+            CHECK(in_order);
+            CHECK(queue.empty());
+        }
+    }
+}
@@ -0,0 +1,186 @@
+#include "ADVtask_queue.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+using Task = Callback<void(*)()>;
+
+namespace
+{
+    TaskQueue<4> queue0;
+
+    int order[8];
+    int executed = 0;
+    void run(int n) { order[executed++] = n; }
+
+    struct Stepper
+    {
+        void start() { queue0.post(Task{this, &Stepper::step1}); }
+        void step1() { n_ = 1; queue0.post(Task{this, &Stepper::step2}); }
+        void step2() { n_ = 2; }
+        int n_ = 0;
+    };
+
+    unsigned ticks = 0;
+    unsigned now() { return ticks; }
+}
+
+SCENARIO("Tasks are executed in order", "[task_queue]")
+{
+    executed = 0;
+    GIVEN("A queue with tasks posted by two producers")
+    {
+        TaskQueue<4> queue;
+        queue.post(Task{[]{ run(1); }});
+        queue.post(Task{[]{ run(2); }});
+        THEN("No task is lost") CHECK(queue.size() == 2);
+        WHEN("The tasks are run")
+        {
+            CHECK(queue.run_pending() == 2);
+            THEN("They are run in order")
+            {
+                REQUIRE(executed == 2);
+                CHECK(order[0] == 1);
+                CHECK(order[1] == 2);
+            }
+            THEN("The queue is empty") CHECK(queue.empty());
+        }
+        WHEN("A task is posted in front")
+        {
+            queue.post_front(Task{[]{ run(0); }});
+            queue.run_pending();
+            THEN("It runs first")
+            {
+                REQUIRE(executed == 3);
+                CHECK(order[0] == 0);
+                CHECK(order[1] == 1);
+                CHECK(order[2] == 2);
+            }
+        }
+        WHEN("Only one task is run")
+        {
+            CHECK(queue.run_pending(1) == 1);
+            THEN("The other is still pending") CHECK(queue.size() == 1);
+        }
+        WHEN("The queue is filled")
+        {
+            queue.post(Task{[]{ run(3); }});
+            queue.post(Task{[]{ run(4); }});
+            THEN("It is full") CHECK(queue.full());
+            THEN("Other tasks are dropped")
+            {
+                CHECK_FALSE(queue.post(Task{[]{ run(5); }}));
+                CHECK(queue.dropped() == 1);
+            }
+            THEN("The high-water mark is recorded")
+            {
+                queue.run_pending();
+                CHECK(queue.high_water() == 4);
+            }
+        }
+    }
+}
+
+SCENARIO("Tasks can post other tasks", "[task_queue]")
+{
+    GIVEN("A task posting another task")
+    {
+        queue0.clear();
+        Stepper stepper;
+        stepper.start();
+        WHEN("The pending tasks are run")
+        {
+            queue0.run_pending();
+            THEN("Only the first step is run") CHECK(stepper.n_ == 1);
+            WHEN("The pending tasks are run again")
+            {
+                queue0.run_pending();
+                THEN("The second step is run") CHECK(stepper.n_ == 2);
+            }
+        }
+    }
+}
+
+SCENARIO("Tasks posted in front while running are run in place of the last ones", "[task_queue]")
+{
+    executed = 0;
+    GIVEN("A task posting another task in front, followed by a task")
+    {
+        queue0.clear();
+        queue0.post(Task{[]{ run(1); queue0.post_front(Task{[]{ run(3); }}); }});
+        queue0.post(Task{[]{ run(2); }});
+        WHEN("The pending tasks are run")
+        {
+            auto ran = queue0.run_pending();
+            THEN("The task posted in front is run and the last one waits")
+            {
+                CHECK(ran == 2);
+                REQUIRE(executed == 2);
+                CHECK(order[0] == 1);
+                CHECK(order[1] == 3);
+                CHECK(queue0.size() == 1);
+            }
+        }
+    }
+}
+
+SCENARIO("A task can clear the queue", "[task_queue]")
+{
+    executed = 0;
+    ticks = 0;
+    GIVEN("A task clearing the queue followed by other tasks")
+    {
+        queue0.clear();
+        queue0.post(Task{[]{ run(0); queue0.clear(); }});
+        queue0.post(Task{[]{ run(1); }});
+        queue0.post(Task{[]{ run(2); }});
+        WHEN("The pending tasks are run")
+        {
+            auto ran = queue0.run_pending();
+            THEN("The tasks after it are not run")
+            {
+                CHECK(ran == 1);
+                CHECK(executed == 1);
+                CHECK(queue0.empty());
+            }
+            THEN("The queue is still usable")
+            {
+                CHECK(queue0.post(Task{[]{ run(3); }}));
+                CHECK(queue0.size() == 1);
+                CHECK(queue0.run_pending() == 1);
+                CHECK(order[1] == 3);
+            }
+        }
+        WHEN("The pending tasks are run with a time budget")
+        {
+            auto ran = queue0.run_pending_for(now, 100u);
+            THEN("The tasks after it are not run")
+            {
+                CHECK(ran == 1);
+                CHECK(executed == 1);
+                CHECK(queue0.empty());
+            }
+        }
+    }
+}
+
+SCENARIO("Tasks can be run with a time budget", "[task_queue]")
+{
+    executed = 0;
+    ticks = 0;
+    GIVEN("A queue with three tasks taking 10 ticks each")
+    {
+        TaskQueue<4> queue;
+        for(int i = 0; i < 3; ++i)
+            queue.post(Task{[i]{ run(i); ticks += 10; }});
+        WHEN("They are run with a budget of 15 ticks")
+        {
+            auto ran = queue.run_pending_for(now, 15u);
+            THEN("Only two tasks are run")
+            {
+                CHECK(ran == 2);
+                CHECK(queue.size() == 1);
+            }
+        }
+    }
+}
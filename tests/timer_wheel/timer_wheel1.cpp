@@ -0,0 +1,106 @@
+#include "ADVtimer_wheel.h"
+#include "catch.hpp"
+
+using namespace adv;
+
+using Task = Callback<void(*)()>;
+
+namespace
+{
+    int fired[8];
+    int count = 0;
+    void fire(int n) { fired[count++] = n; }
+
+    using Wheel = TimerWheel<8, 16>;
+
+    struct Heater
+    {
+        explicit Heater(Wheel& wheel): wheel_{wheel} {}
+        void start() { wheel_.schedule(10, Task{this, &Heater::check}); }
+        void check() { ++checks_; if(checks_ < 3) start(); }
+
+        Wheel& wheel_;
+        int checks_ = 0;
+    };
+}
+
+SCENARIO("Timers fire at their deadline", "[timer_wheel]")
+{
+    count = 0;
+    GIVEN("A wheel with three timers")
+    {
+        Wheel wheel;
+        wheel.schedule(5, Task{[]{ fire(5); }});
+        wheel.schedule(20, Task{[]{ fire(20); }});  // More than one turn of the wheel
+        auto timer = wheel.schedule(10, Task{[]{ fire(10); }});
+        THEN("They are scheduled") CHECK(wheel.size() == 3);
+
+        WHEN("Time advances before the first deadline")
+        {
+            CHECK(wheel.advance(4) == 0);
+            THEN("No timer fires") CHECK(count == 0);
+        }
+        WHEN("Time advances to the first deadline")
+        {
+            CHECK(wheel.advance(5) == 1);
+            THEN("The first timer fires") CHECK(fired[0] == 5);
+            THEN("The other timers are still scheduled") CHECK(wheel.size() == 2);
+        }
+        WHEN("Time advances past all the deadlines at once")
+        {
+            CHECK(wheel.advance(100) == 3);
+            THEN("All the timers fire") CHECK(wheel.empty());
+        }
+        WHEN("Time advances one turn of the wheel")
+        {
+            wheel.advance(16);
+            THEN("The timer beyond the turn is not fired") CHECK(count == 2);
+            wheel.advance(20);
+            THEN("It fires at its deadline")
+            {
+                CHECK(count == 3);
+                CHECK(fired[2] == 20);
+            }
+        }
+        WHEN("A timer is cancelled")
+        {
+            CHECK(wheel.cancel(timer));
+            wheel.advance(100);
+            THEN("It does not fire") CHECK(count == 2);
+            THEN("It can not be cancelled twice") CHECK_FALSE(wheel.cancel(timer));
+        }
+        WHEN("A timer is cancelled after it fired")
+        {
+            wheel.advance(10);
+            THEN("It can not be cancelled") CHECK_FALSE(wheel.cancel(timer));
+        }
+    }
+    GIVEN("A full wheel")
+    {
+        Wheel wheel;
+        for(int i = 0; i < 8; ++i) wheel.schedule(1, Task{[]{ fire(0); }});
+        THEN("No more timer can be scheduled") CHECK_FALSE(wheel.schedule(1, Task{[]{ fire(1); }}));
+    }
+    GIVEN("A wheel whose time wraps")
+    {
+        Wheel wheel{static_cast<unsigned long>(-3)};
+        wheel.schedule(5, Task{[]{ fire(1); }});
+        THEN("The timer fires after the wrap") CHECK(wheel.advance(2) == 1);
+    }
+}
+
+SCENARIO("Timers can reschedule themselves", "[timer_wheel]")
+{
+    GIVEN("A heater checked every 10 ticks, three times")
+    {
+        Wheel wheel;
+        Heater heater{wheel};
+        heater.start();
+        for(unsigned long now = 1; now <= 50; ++now) wheel.advance(now);
+        THEN("It is checked three times")
+        {
+            CHECK(heater.checks_ == 3);
+            CHECK(wheel.empty());
+        }
+    }
+}